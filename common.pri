@@ -58,6 +58,10 @@ CONFIG(debug, debug|release){
     DEFINES += V_NO_ASSERT V_NO_DEBUG
 }
 
+noTrace{ # For disable tracing instrumentation run qmake with CONFIG+=noTrace
+    DEFINES += V_NO_TRACE
+}
+
 CONFIG += c++14
 
 # Only do debug or release builds also on windows
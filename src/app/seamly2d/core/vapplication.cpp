@@ -61,6 +61,7 @@
 #include "../ifc/exception/vexceptionwrongid.h"
 #include "../vmisc/logging.h"
 #include "../vmisc/vmath.h"
+#include "../vmisc/vtrace.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "../vwidgets/vmaingraphicsview.h"
 
@@ -295,12 +296,20 @@ VApplication::VApplication(int &argc, char **argv)
     loadTranslations(QLocale().name());// By default the console version uses system locale
     VCommandLine::Get(*this);
     undoStack = new QUndoStack(this);
+
+    if (not CommandLine()->OptTraceFile().isEmpty())
+    {
+        VTrace::Start();
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 VApplication::~VApplication()
 {
     qCDebug(vApp, "Application closing.");
+
+    SaveTrace();
+
     qInstallMessageHandler(nullptr); // Restore the message handler
     delete trVars;
     VCommandLine::Reset();
@@ -362,38 +371,38 @@ bool VApplication::notify(QObject *receiver, QEvent *event)
     {
         qCCritical(vApp, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error parsing file. Program will be terminated.")), //-V807
                    qUtf8Printable(error.ErrorMessage()), qUtf8Printable(error.DetailedInformation()));
-        exit(V_EX_DATAERR);
+        ExitOnError(V_EX_DATAERR);
     }
     catch (const VExceptionBadId &error)
     {
         qCCritical(vApp, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error bad id. Program will be terminated.")),
                    qUtf8Printable(error.ErrorMessage()), qUtf8Printable(error.DetailedInformation()));
-        exit(V_EX_DATAERR);
+        ExitOnError(V_EX_DATAERR);
     }
     catch (const VExceptionConversionError &error)
     {
         qCCritical(vApp, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error can't convert value. Program will be terminated.")),
                    qUtf8Printable(error.ErrorMessage()), qUtf8Printable(error.DetailedInformation()));
-        exit(V_EX_DATAERR);
+        ExitOnError(V_EX_DATAERR);
     }
     catch (const VExceptionEmptyParameter &error)
     {
         qCCritical(vApp, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error empty parameter. Program will be terminated.")),
                    qUtf8Printable(error.ErrorMessage()), qUtf8Printable(error.DetailedInformation()));
-        exit(V_EX_DATAERR);
+        ExitOnError(V_EX_DATAERR);
     }
     catch (const VExceptionWrongId &error)
     {
         qCCritical(vApp, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error wrong id. Program will be terminated.")),
                    qUtf8Printable(error.ErrorMessage()), qUtf8Printable(error.DetailedInformation()));
-        exit(V_EX_DATAERR);
+        ExitOnError(V_EX_DATAERR);
     }
     catch (const VExceptionToolWasDeleted &error)
     {
         qCCritical(vApp, "%s\n\n%s\n\n%s",
                    qUtf8Printable("Unhadled deleting tool. Continue use object after deleting"),
                    qUtf8Printable(error.ErrorMessage()), qUtf8Printable(error.DetailedInformation()));
-        exit(V_EX_DATAERR);
+        ExitOnError(V_EX_DATAERR);
     }
     catch (const VException &error)
     {
@@ -407,16 +416,42 @@ bool VApplication::notify(QObject *receiver, QEvent *event)
     catch (const qmu::QmuParserError &error)
     {
         qCCritical(vApp, "%s", qUtf8Printable(tr("Parser error: %1. Program will be terminated.").arg(error.GetMsg())));
-        exit(V_EX_DATAERR);
+        ExitOnError(V_EX_DATAERR);
     }
     catch (std::exception &error)
     {
         qCCritical(vApp, "%s", qUtf8Printable(tr("Exception thrown: %1. Program will be terminated.").arg(error.what())));
-        exit(V_EX_SOFTWARE);
+        ExitOnError(V_EX_SOFTWARE);
     }
     return false;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SaveTrace write recorded trace events if the --trace option was used.
+ */
+void VApplication::SaveTrace() const
+{
+    const QString traceFile = CommandLine()->OptTraceFile();
+    if (not traceFile.isEmpty() && not VTrace::Save(traceFile))
+    {
+        qCCritical(vApp, "Can't write trace file %s.", qUtf8Printable(traceFile));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ExitOnError leave the event loop after an unhandled error.
+ *
+ * The trace of the failed run is written right away, without waiting for the destructor.
+ * @param exitCode exit code.
+ */
+void VApplication::ExitOnError(int exitCode) const
+{
+    SaveTrace();
+    QCoreApplication::exit(exitCode);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VApplication::SeamlyMeFilePath() const
 {
@@ -654,7 +689,11 @@ const VTranslateVars *VApplication::TrVars()
 //---------------------------------------------------------------------------------------------------------------------
 void VApplication::InitTrVars()
 {
-    if (trVars == nullptr)
+    if (trVars != nullptr)
+    {
+        trVars->Retranslate();
+    }
+    else
     {
         trVars = new VTranslateVars();
     }
@@ -130,6 +130,9 @@ private slots:
     void               GatherLogs()const;
 #endif // defined(Q_OS_WIN) && defined(Q_CC_GNU)
 
+    void               SaveTrace() const;
+    void               ExitOnError(int exitCode) const;
+
     QString            LogDirPath()const;
     QString            LogPath()const;
     bool               CreateLogDir()const;
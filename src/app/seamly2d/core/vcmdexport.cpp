@@ -268,6 +268,13 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
                                                     "showing the main window. The key have priority before key '%1'.")
                                                     .arg(LONG_OPTION_BASENAME)));
 
+    optionsIndex.insert(LONG_OPTION_TRACE, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_TRACE,
+                                          translate("VCommandLine", "Record time spent in parsing, formulas, geometry, "
+                                                    "layout and export and save it to the file in Chrome trace format. "
+                                                    "The file can be opened in Perfetto or chrome://tracing."),
+                                          translate("VCommandLine", "The trace file")));
+
     optionsIndex.insert(LONG_OPTION_NO_HDPI_SCALING, index++);
     options.append(new QCommandLineOption(QStringList() << LONG_OPTION_NO_HDPI_SCALING,
                                           translate("VCommandLine", "Disable high dpi scaling. Call this option if has "
@@ -532,6 +539,12 @@ bool VCommandLine::IsNoScalingEnabled() const
     return parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_NO_HDPI_SCALING)));
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+QString VCommandLine::OptTraceFile() const
+{
+    return parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_TRACE)));
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommandLine::IsExportEnabled() const
 {
@@ -59,6 +59,9 @@ class VCommandLine
 
     bool IsNoScalingEnabled() const;
 
+    //@brief returns path to the trace file or empty string if tracing was not requested
+    QString OptTraceFile() const;
+
     //@brief tests if user enabled export from cmd, throws exception if not exactly 1 input VAL file supplied in case
     //export enabled
     bool IsExportEnabled() const;
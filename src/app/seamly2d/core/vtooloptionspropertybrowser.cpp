@@ -89,6 +89,8 @@ VToolOptionsPropertyBrowser::VToolOptionsPropertyBrowser(const VContainer *data,
     , propertyToId(QMap<VPE::VProperty *, QString>())
     , idToProperty(QMap<QString, VPE::VProperty *>())
     , m_centerPointStr(tr("Center point"))
+    , m_objectPropertyTypes()
+    , m_objectLists()
 {
     propertyModel = new VPE::VPropertyModel(this);
     formView = new VPE::VPropertyFormView(propertyModel, parent);
@@ -110,6 +112,8 @@ void VToolOptionsPropertyBrowser::clearPropertyBrowser()
     propertyModel->clear();
     propertyToId.clear();
     idToProperty.clear();
+    m_objectPropertyTypes.clear();
+    m_objectLists.clear();
     currentItem = nullptr;
 }
 
@@ -237,6 +241,14 @@ void VToolOptionsPropertyBrowser::showItemOptions(QGraphicsItem *item)
 
 //---------------------------------------------------------------------------------------------------------------------
 void VToolOptionsPropertyBrowser::updateOptions()
+{
+    m_objectLists.clear(); // Pattern data could change, object lists must be read again
+
+    updateItemOptions();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VToolOptionsPropertyBrowser::updateItemOptions()
 {
     if (currentItem == nullptr)
     {
@@ -518,9 +530,15 @@ void VToolOptionsPropertyBrowser::itemClicked(QGraphicsItem *item)
         return;
     }
 
+    if (rebindItemOptions(item))
+    {
+        return;
+    }
+
     propertyModel->clear();
     propertyToId.clear();
     idToProperty.clear();
+    m_objectPropertyTypes.clear();
 
     if (currentItem != nullptr)
     {
@@ -534,6 +552,7 @@ void VToolOptionsPropertyBrowser::itemClicked(QGraphicsItem *item)
     currentItem = item;
     if (currentItem == nullptr)
     {
+        m_objectLists.clear();
         formView->setTitle("");
         return;
     }
@@ -541,6 +560,45 @@ void VToolOptionsPropertyBrowser::itemClicked(QGraphicsItem *item)
     showItemOptions(currentItem);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief rebindItemOptions reuses the shown properties for another tool of the same type.
+ *
+ * Every tool type always shows the same set of properties, so instead of rebuilding the model only object lists are
+ * replaced and values are read from the new tool.
+ * @param item new item.
+ * @return true if the properties were rebound, false if they must be built from scratch.
+ */
+bool VToolOptionsPropertyBrowser::rebindItemOptions(QGraphicsItem *item)
+{
+    if (item == nullptr || currentItem == nullptr || idToProperty.isEmpty() || item->type() != currentItem->type())
+    {
+        return false;
+    }
+
+    VAbstractTool *tool = dynamic_cast<VAbstractTool *>(item);
+    VAbstractTool *previousTool = dynamic_cast<VAbstractTool *>(currentItem);
+    if (tool == nullptr || previousTool == nullptr)
+    {
+        return false;
+    }
+
+    previousTool->ShowVisualization(false); // hide for previous tool
+    currentItem = item;
+
+    auto i = m_objectPropertyTypes.constBegin();
+    while (i != m_objectPropertyTypes.constEnd())
+    {
+        VPE::VObjectProperty *property = static_cast<VPE::VObjectProperty *>(idToProperty.value(i.key()));
+        property->setObjectsList(getObjectList(tool->getId(), item->type(), i.value()));
+        ++i;
+    }
+
+    tool->ShowVisualization(true);
+    updateItemOptions();
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VToolOptionsPropertyBrowser::addPropertyFormula(const QString &propertyName, const VFormula &formula,
                                                      const QString &attrName)
@@ -756,12 +814,31 @@ void VToolOptionsPropertyBrowser::addObjectProperty(Tool *tool, const QString &p
     }
     pointsProperty->setValue(index);
     addProperty(pointsProperty, id);
+    m_objectPropertyTypes.insert(id, objType);
 }
 
 template<class Tool>
 QMap<QString, quint32> VToolOptionsPropertyBrowser::getObjectList(Tool *tool, GOType objType)
 {
-    quint32 toolId = tool->getId();
+    return getObjectList(tool->getId(), tool->type(), objType);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getObjectList returns objects of the given type that were created before the tool.
+ *
+ * Lists are cached per tool and object type, so a page with several object properties and pages of other tools read
+ * the history once. The cache is dropped when the pattern data is updated.
+ */
+QMap<QString, quint32> VToolOptionsPropertyBrowser::getObjectList(quint32 toolId, int toolType, GOType objType)
+{
+    const QPair<quint32, int> key(toolId, static_cast<int>(objType));
+    auto cached = m_objectLists.constFind(key);
+    if (cached != m_objectLists.constEnd())
+    {
+        return cached.value();
+    }
+
     QHash<quint32, QSharedPointer<VGObject>> objects;
 
     QVector<VToolRecord> history = qApp->getCurrentDocument()->getBlockHistory();
@@ -888,10 +965,12 @@ QMap<QString, quint32> VToolOptionsPropertyBrowser::getObjectList(Tool *tool, GO
         }
     }
 
-    if (tool->type() == VToolMove::Type)
+    if (toolType == VToolMove::Type)
     {
         map.insert(m_centerPointStr, NULL_ID);
     }
+
+    m_objectLists.insert(key, map);
     return map;
 }
 
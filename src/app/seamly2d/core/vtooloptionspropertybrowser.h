@@ -58,7 +58,9 @@
 
 #include <QEvent>
 #include <QObject>
+#include <QHash>
 #include <QMap>
+#include <QPair>
 
 #include "../vgeometry/vgeometrydef.h"
 #include "../vpropertyexplorer/vproperty.h"
@@ -97,12 +99,21 @@ private slots:
     QMap<QString, VPE::VProperty *>  idToProperty;
     QString                          m_centerPointStr;
 
+    /** @brief m_objectPropertyTypes object type of each object list property on the current page. */
+    QMap<QString, GOType>            m_objectPropertyTypes;
+
+    /** @brief m_objectLists cached object lists by tool id and object type. */
+    QHash<QPair<quint32, int>, QMap<QString, quint32> > m_objectLists;
+
 private:
     void addProperty(VPE::VProperty *property, const QString &id);
     void showItemOptions(QGraphicsItem *item);
+    void updateItemOptions();
+    bool rebindItemOptions(QGraphicsItem *item);
 
     template<class Tool>
     QMap<QString, quint32> getObjectList(Tool *tool, GOType objType);
+    QMap<QString, quint32> getObjectList(quint32 toolId, int toolType, GOType objType);
 
     template<class Tool>
     void setPointName(const QString &name);
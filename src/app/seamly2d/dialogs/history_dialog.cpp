@@ -636,8 +636,7 @@ void HistoryDialog::initializeTable()
  */
 void HistoryDialog::showTool()
 {
-    const QVector<VToolRecord> *history = m_doc->getHistory();
-    if (!history->empty())
+    if (ui->tableWidget->rowCount() > 0)
     {
         QTableWidgetItem *item = ui->tableWidget->item(0, 1);
         item->setSelected(true);
@@ -52,6 +52,7 @@
 
 #include "pieces_widget.h"
 #include "ui_pieces_widget.h"
+#include "../ifc/ifcdef.h"
 #include "../ifc/xml/vabstractpattern.h"
 #include "../vpatterndb/floatItemData/vpiecelabeldata.h"
 #include "../vpatterndb/vcontainer.h"
@@ -60,6 +61,7 @@
 #include "../vtools/undocommands/togglepieceinlayout.h"
 #include "../vtools/undocommands/toggle_piecelock.h"
 #include "../vtools/undocommands/set_piece_color.h"
+#include "../vtools/undocommands/set_pieces_attribute.h"
 #include "../vwidgets/piece_tablewidgetitem.h"
 #include "../vwidgets/vmaingraphicsscene.h"
 
@@ -69,6 +71,7 @@
 #include <QPainter>
 #include <QPixmap>
 #include <QRegularExpression>
+#include <QSet>
 #include <QTableWidget>
 #include <QUndoStack>
 
@@ -199,35 +202,8 @@ void PiecesWidget::togglePiece(quint32 id)
 
             if (item && item->data(Qt::UserRole).toUInt() == id)
             {
-                    selectedRow = row;
-                    VPiece piece = pieces->value(id);
-                    const bool inLayout = piece.isInLayout();
-                    inLayout ? item->setIcon(QIcon("://icon/32x32/visible_on.png"))
-                             : item->setIcon(QIcon("://icon/32x32/visible_off.png"));
-                    {
-                        QTableWidgetItem *item = ui->tableWidget->item(row, 1);
-                        const bool locked = piece.isLocked();
-                        locked ? item->setIcon(QIcon("://icon/32x32/lock_on.png"))
-                               : item->setIcon(QIcon("://icon/32x32/lock_off.png"));
-                    }
-
-                    {
-                        QTableWidgetItem *item = ui->tableWidget->item(row, 2);
-                        QPixmap pixmap(20, 20);
-                        pixmap.fill(QColor(piece.getColor()));
-                        item->setIcon(QIcon(pixmap));
-                        item->setData(Qt::UserRole, piece.getColor());
-                    }
-
-                    {
-                        QTableWidgetItem *item = ui->tableWidget->item(row, 3);
-                        item->setText(formatLetterString(piece));
-                    }
-
-                    {
-                        QTableWidgetItem *item = ui->tableWidget->item(row, 4);
-                        item->setText(piece.GetName());
-                    }
+                selectedRow = row;
+                updateRow(row, pieces->value(id));
             }
         }
     }
@@ -236,6 +212,33 @@ void PiecesWidget::togglePiece(quint32 id)
     ui->tableWidget->setSortingEnabled(true);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief togglePieces updates the rows of the given pieces in one pass over the table.
+ * @param ids piece ids.
+ */
+void PiecesWidget::togglePieces(const QVector<quint32> &ids)
+{
+    ui->tableWidget->setSortingEnabled(false);
+
+    const QSet<quint32> changed(ids.constBegin(), ids.constEnd());
+    const QHash<quint32, VPiece> *pieces = m_data->DataPieces();
+
+    for (int row = 0; row < ui->tableWidget->rowCount(); ++row)
+    {
+        QTableWidgetItem *item = ui->tableWidget->item(row, 0);
+        SCASSERT(item != nullptr)
+
+        const quint32 id = item->data(Qt::UserRole).toUInt();
+        if (changed.contains(id) && pieces->contains(id))
+        {
+            updateRow(row, pieces->value(id));
+        }
+    }
+
+    ui->tableWidget->setSortingEnabled(true);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void PiecesWidget::updateList()
 {
@@ -342,6 +345,27 @@ void PiecesWidget::cellDoubleClicked(int row, int column)
     emit Highlight(NULL);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void PiecesWidget::updateRow(int row, const VPiece &piece)
+{
+    QTableWidgetItem *item = ui->tableWidget->item(row, 0);
+    piece.isInLayout() ? item->setIcon(QIcon("://icon/32x32/visible_on.png"))
+                       : item->setIcon(QIcon("://icon/32x32/visible_off.png"));
+
+    item = ui->tableWidget->item(row, 1);
+    piece.isLocked() ? item->setIcon(QIcon("://icon/32x32/lock_on.png"))
+                     : item->setIcon(QIcon("://icon/32x32/lock_off.png"));
+
+    item = ui->tableWidget->item(row, 2);
+    QPixmap pixmap(20, 20);
+    pixmap.fill(QColor(piece.getColor()));
+    item->setIcon(QIcon(pixmap));
+    item->setData(Qt::UserRole, piece.getColor());
+
+    ui->tableWidget->item(row, 3)->setText(formatLetterString(piece));
+    ui->tableWidget->item(row, 4)->setText(piece.GetName());
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void PiecesWidget::fillTable(const QHash<quint32, VPiece> *pieces)
 {
@@ -440,6 +464,7 @@ void PiecesWidget::toggleInLayoutPieces(bool inLayout)
         return;
     }
 
+    QMap<quint32, bool> states;
     for (int row = 0; row<ui->tableWidget->rowCount(); ++row)
     {
         QTableWidgetItem *item = ui->tableWidget->item(row, 0);
@@ -448,12 +473,12 @@ void PiecesWidget::toggleInLayoutPieces(bool inLayout)
         {
             if (!(inLayout == allPieces->value(id).isInLayout()))
             {
-                TogglePieceInLayout *command = new TogglePieceInLayout(id, inLayout, m_data, m_doc);
-                connect(command, &TogglePieceInLayout::updateList, this, &PiecesWidget::togglePiece);
-                qApp->getUndoStack()->push(command);
+                states.insert(id, inLayout);
             }
         }
     }
+
+    setPiecesAttribute(AttrInLayout, states, inLayout ? tr("Include all pieces") : tr("Exclude all pieces"));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -464,9 +489,11 @@ void PiecesWidget::toggleLockedPieces(bool lock)
     const QHash<quint32, VPiece> *allPieces = m_data->DataPieces();
     if (allPieces->count() == 0)
     {
+        ui->tableWidget->blockSignals(false);
         return;
     }
 
+    QMap<quint32, bool> states;
     for (int row = 0; row<ui->tableWidget->rowCount(); ++row)
     {
         QTableWidgetItem *item = ui->tableWidget->item(row, 1);
@@ -475,18 +502,36 @@ void PiecesWidget::toggleLockedPieces(bool lock)
         {
             if (!(lock == allPieces->value(id).isLocked()))
             {
-                TogglePieceLock *command = new TogglePieceLock(id, lock, m_data, m_doc);
-                connect(command, &TogglePieceLock::updateList, this, &PiecesWidget::togglePiece);
-                qApp->getUndoStack()->push(command);
-
-                VMainGraphicsScene *scene = qobject_cast<VMainGraphicsScene *>(qApp->getCurrentScene());
-                SCASSERT(scene != nullptr)
-                emit scene->pieceLockedChanged(id, !lock);
+                states.insert(id, lock);
             }
         }
     }
+
+    setPiecesAttribute(AttrPieceLocked, states, lock ? tr("Lock all pieces") : tr("Unlock all pieces"));
     ui->tableWidget->blockSignals(false);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief setPiecesAttribute changes the attribute of all given pieces as one undo step.
+ * @param attribute AttrInLayout or AttrPieceLocked.
+ * @param states new state of each piece, by piece id.
+ * @param text undo command text.
+ */
+void PiecesWidget::setPiecesAttribute(const QString &attribute, const QMap<quint32, bool> &states,
+                                      const QString &text)
+{
+    if (states.isEmpty())
+    {
+        return;
+    }
+
+    SetPiecesAttribute *command = new SetPiecesAttribute(attribute, states, m_data, m_doc);
+    command->setText(text);
+    connect(command, &SetPiecesAttribute::updateList, this, &PiecesWidget::togglePieces);
+    qApp->getUndoStack()->push(command);
+}
+
 /**
  * @brief headerClicked Sort state whenever header section clicked.
  * @param index
@@ -612,9 +657,7 @@ void PiecesWidget::showContextMenu(const QPoint &pos)
 
 void PiecesWidget::includeAllPieces()
 {
-    qApp->getUndoStack()->beginMacro(tr("Include all pieces"));
     toggleInLayoutPieces(true);
-    qApp->getUndoStack()->endMacro();
 }
 
 void PiecesWidget::invertIncludedPieces()
@@ -623,37 +666,29 @@ void PiecesWidget::invertIncludedPieces()
     {
         return;
     }
-    qApp->getUndoStack()->beginMacro(tr("Invert included pieces"));
 
+    QMap<quint32, bool> states;
     for (int row = 0; row < ui->tableWidget->rowCount(); ++row)
     {
         QTableWidgetItem *item = ui->tableWidget->item(row, 0);
         const quint32 id = item->data(Qt::UserRole).toUInt();
         if (m_allPieces->contains(id))
         {
-            const bool inLayout = !m_allPieces->value(id).isInLayout();
-
-            TogglePieceInLayout *command = new TogglePieceInLayout(id, inLayout, m_data, m_doc);
-            connect(command, &TogglePieceInLayout::updateList, this, &PiecesWidget::togglePiece);
-            qApp->getUndoStack()->push(command);
+            states.insert(id, !m_allPieces->value(id).isInLayout());
         }
     }
 
-    qApp->getUndoStack()->endMacro();
+    setPiecesAttribute(AttrInLayout, states, tr("Invert included pieces"));
 }
 
 void PiecesWidget::excludeAllPieces()
 {
-    qApp->getUndoStack()->beginMacro(tr("Exclude all pieces"));
     toggleInLayoutPieces(false);
-    qApp->getUndoStack()->endMacro();
 }
 
 void PiecesWidget::lockAllPieces()
 {
-    qApp->getUndoStack()->beginMacro(tr("Lock all pieces"));
     toggleLockedPieces(true);
-    qApp->getUndoStack()->endMacro();
 }
 
 void PiecesWidget::invertLockedPieces()
@@ -662,34 +697,24 @@ void PiecesWidget::invertLockedPieces()
     {
         return;
     }
-    qApp->getUndoStack()->beginMacro(tr("Invert locked pieces"));
 
+    QMap<quint32, bool> states;
     for (int row = 0; row < ui->tableWidget->rowCount(); ++row)
     {
         QTableWidgetItem *item = ui->tableWidget->item(row, 1);
         const quint32 id = item->data(Qt::UserRole).toUInt();
         if (m_allPieces->contains(id))
         {
-            const bool lock = !m_allPieces->value(id).isLocked();
-
-            TogglePieceLock *command = new TogglePieceLock(id, lock, m_data, m_doc);
-            connect(command, &TogglePieceLock::updateList, this, &PiecesWidget::togglePiece);
-            qApp->getUndoStack()->push(command);
-
-            VMainGraphicsScene *scene = qobject_cast<VMainGraphicsScene *>(qApp->getCurrentScene());
-            SCASSERT(scene != nullptr)
-            emit scene->pieceLockedChanged(id, !lock);
+            states.insert(id, !m_allPieces->value(id).isLocked());
         }
     }
 
-    qApp->getUndoStack()->endMacro();
+    setPiecesAttribute(AttrPieceLocked, states, tr("Invert locked pieces"));
 }
 
 void PiecesWidget::unlockAllPieces()
 {
-    qApp->getUndoStack()->beginMacro(tr("Unlock all pieces"));
     toggleLockedPieces(false);
-    qApp->getUndoStack()->endMacro();
 }
 
 void PiecesWidget::editPieceColor(quint32 id)
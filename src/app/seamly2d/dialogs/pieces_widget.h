@@ -54,7 +54,9 @@
 #define PIECES_WIDGET_H
 
 #include <QWidget>
+#include <QMap>
 #include <QTableWidgetItem>
+#include <QVector>
 
 class VAbstractPattern;
 class VContainer;
@@ -78,6 +80,7 @@ class PiecesWidget : public QWidget
 
 public slots:
     void               togglePiece(quint32 id);
+    void               togglePieces(const QVector<quint32> &ids);
     void               updateList();
     void               selectPiece(quint32 id);
 
@@ -97,8 +100,11 @@ private slots:
     const QHash<quint32, VPiece> *m_allPieces;
 
     void               fillTable(const QHash<quint32, VPiece> *details);
+    void               updateRow(int row, const VPiece &piece);
     void               toggleInLayoutPieces(bool inLayout);
     void               toggleLockedPieces(bool lock);
+    void               setPiecesAttribute(const QString &attribute, const QMap<quint32, bool> &states,
+                                          const QString &text);
     void               headerClicked(int index);
     QString            formatLetterString(const VPiece piece);
     void               includeAllPieces();
@@ -68,6 +68,7 @@
 #include "../vmisc/def.h"
 #include "../vmisc/qxtcsvmodel.h"
 #include "../vmisc/dialogs/dialogexporttocsv.h"
+#include "../vmisc/vtrace.h"
 #include "undocommands/rename_draftblock.h"
 #include "core/vtooloptionspropertybrowser.h"
 #include "options.h"
@@ -116,6 +117,7 @@
 #include <QTextCodec>
 #include <QDoubleSpinBox>
 #include <QSharedPointer>
+#include <QtConcurrentRun>
 
 #if defined(Q_OS_MAC)
 #include <QMimeData>
@@ -176,6 +178,10 @@ MainWindow::MainWindow(QWidget *parent)
     , leftGoToStage(nullptr)
     , rightGoToStage(nullptr)
     , autoSaveTimer(nullptr)
+    , scenePreviewTimer(new QTimer(this))
+    , nextScenePreview(-1)
+    , autoSaveWatcher(new QFutureWatcher<bool>(this))
+    , autoSavePending(false)
     , guiEnabled(true)
     , gradationHeights(nullptr)
     , gradationSizes(nullptr)
@@ -235,8 +241,20 @@ MainWindow::MainWindow(QWidget *parent)
 
     connect(qApp->getUndoStack(), &QUndoStack::cleanChanged, this, &MainWindow::patternChangesWereSaved);
 
+    connect(autoSaveWatcher, &QFutureWatcher<bool>::finished, this, [this]()
+    {
+        if (autoSavePending)
+        {
+            AutoSavePattern();
+        }
+    });
     InitAutoSave();
 
+    // Sheet previews are rendered one by one from event loop, so layout list appears at once.
+    scenePreviewTimer->setSingleShot(true);
+    scenePreviewTimer->setInterval(0);
+    connect(scenePreviewTimer, &QTimer::timeout, this, &MainWindow::UpdateNextScenePreview);
+
     ui->draft_ToolBox->setCurrentIndex(0);
 
     ReadSettings();
@@ -1809,6 +1827,8 @@ void MainWindow::customEvent(QEvent *event)
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindow::CleanLayout()
 {
+    scenePreviewTimer->stop();
+    nextScenePreview = -1;
     qDeleteAll (scenes);
     scenes.clear();
     shadows.clear();
@@ -1821,9 +1841,10 @@ void MainWindow::CleanLayout()
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindow::PrepareSceneList()
 {
+    const QSize iconSize = ui->listWidget->iconSize();
     for (int i=1; i<=scenes.size(); ++i)
     {
-        QListWidgetItem *item = new QListWidgetItem(ScenePreview(i-1), QString::number(i));
+        QListWidgetItem *item = new QListWidgetItem(ScenePreviewPlaceholder(i-1, iconSize), QString::number(i));
         ui->listWidget->addItem(item);
     }
 
@@ -1831,7 +1852,32 @@ void MainWindow::PrepareSceneList()
     {
         ui->listWidget->setCurrentRow(0);
         SetLayoutModeActions();
+
+        nextScenePreview = 0;
+        scenePreviewTimer->start();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UpdateNextScenePreview replace placeholder of next sheet with real preview and schedule the following one.
+ */
+void MainWindow::UpdateNextScenePreview()
+{
+    if (nextScenePreview < 0 || nextScenePreview >= scenes.size())
+    {
+        nextScenePreview = -1;
+        return;
+    }
+
+    QListWidgetItem *item = ui->listWidget->item(nextScenePreview);
+    if (item != nullptr)
+    {
+        item->setIcon(ScenePreview(nextScenePreview, ui->listWidget->iconSize()));
     }
+
+    ++nextScenePreview;
+    scenePreviewTimer->start();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1850,6 +1896,37 @@ void MainWindow::exportToCSVData(const QString &fileName, const DialogExportToCS
         csv.setHeaderText(2, tr("Formula"));
     }
 
+    // Multisize pattern also gets value of each variable for every pair of gradation height and size
+    QVector<qreal> heights;
+    QVector<qreal> sizes;
+    if (qApp->patternType() == MeasurementsType::Multisize && not gradationHeights.isNull()
+            && not gradationSizes.isNull())
+    {
+        for (int h = 0; h < gradationHeights->count(); ++h)
+        {
+            for (int s = 0; s < gradationSizes->count(); ++s)
+            {
+                heights.append(gradationHeights->itemText(h).toDouble());
+                sizes.append(gradationSizes->itemText(s).toDouble());
+            }
+        }
+    }
+
+    QHash<QString, QVector<qreal> > grading;
+    if (not sizes.isEmpty())
+    {
+        grading = pattern->gradingTable(sizes, heights);
+
+        for (int k = 0; k < sizes.size(); ++k)
+        {
+            csv.insertColumn(3 + k);
+            if (dialog.WithHeader())
+            {
+                csv.setHeaderText(3 + k, tr("Height %1, size %2").arg(heights.at(k)).arg(sizes.at(k)));
+            }
+        }
+    }
+
     const QMap<QString, QSharedPointer<VIncrement> > increments = pattern->variablesData();
     QMap<QString, QSharedPointer<VIncrement> >::const_iterator i;
     QMap<quint32, QString> map;
@@ -1884,6 +1961,12 @@ void MainWindow::exportToCSVData(const QString &fileName, const DialogExportToCS
         }
 
         csv.setText(currentRow, 2, formula); // formula
+
+        const QVector<qreal> graded = grading.value(incr->GetName());
+        for (int k = 0; k < graded.size(); ++k)
+        {
+            csv.setText(currentRow, 3 + k, qApp->LocaleToString(graded.at(k))); // value for gradation
+        }
     }
 
     csv.toCSV(fileName, dialog.WithHeader(), dialog.Separator(), QTextCodec::codecForMib(dialog.SelectedMib()));
@@ -3874,6 +3957,7 @@ bool MainWindow::SaveAs()
         return result;
     }
 
+    WaitForAutoSave();
     QFile::remove(qApp->getFilePath() + autosavePrefix);
     m_curFileFormatVersion = VPatternConverter::PatternMaxVer;
     m_curFileFormatVersionStr = VPatternConverter::PatternMaxVerStr;
@@ -3968,6 +4052,7 @@ bool MainWindow::Save()
         bool result = SavePattern(qApp->getFilePath(), error);
         if (result)
         {
+            WaitForAutoSave();
             QFile::remove(qApp->getFilePath() + autosavePrefix);
             m_curFileFormatVersion = VPatternConverter::PatternMaxVer;
             m_curFileFormatVersionStr = VPatternConverter::PatternMaxVerStr;
@@ -4118,6 +4203,7 @@ void MainWindow::FileClosedCorrect()
     qApp->Seamly2DSettings()->SetRestoreFileList(restoreFiles);
 
     // Remove autosave file
+    WaitForAutoSave();
     QFile autofile(qApp->getFilePath() + autosavePrefix);
     if (autofile.exists())
     {
@@ -4862,6 +4948,9 @@ bool MainWindow::SavePattern(const QString &fileName, QString &error)
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief AutoSavePattern start safe saving.
+ *
+ * Pattern is copied on GUI thread and written to disk in background. If previous autosave still runs, the request is
+ * remembered and repeated once it finishes.
  */
 void MainWindow::AutoSavePattern()
 {
@@ -4869,16 +4958,51 @@ void MainWindow::AutoSavePattern()
     {
         return;
     }
+
+    if (autoSaveWatcher->isRunning())
+    {
+        autoSavePending = true;
+        return;
+    }
+    autoSavePending = false;
+
     qCDebug(vMainWindow, "Autosaving pattern.");
 
     if (qApp->getFilePath().isEmpty() == false && this->isWindowModified() == true)
     {
-        QString autofile = qApp->getFilePath() + autosavePrefix;
-        QString error;
-        SavePattern(autofile, error);
+        const QDomDocument snapshot = doc->AutoSaveSnapshot();
+        if (snapshot.isNull())
+        {
+            return;
+        }
+
+        const QString autofile = qApp->getFilePath() + autosavePrefix;
+        autoSaveWatcher->setFuture(QtConcurrent::run([snapshot, autofile]()
+        {
+            QString error;
+            const bool result = VDomDocument::WriteDocument(snapshot, autofile, error);
+            if (not result)
+            {
+                qCWarning(vMainWindow, "Could not save file %s. %s.", qUtf8Printable(autofile),
+                          qUtf8Printable(error));
+            }
+            return result;
+        }));
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WaitForAutoSave block until background autosave is written and drop pending request.
+ *
+ * Must be called before removing autosave file, otherwise the worker can create it again.
+ */
+void MainWindow::WaitForAutoSave()
+{
+    autoSavePending = false;
+    autoSaveWatcher->waitForFinished();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief setCurrentFile the function is called to reset the state of a few variables when a file
@@ -6083,6 +6207,7 @@ QString MainWindow::createDraftBlockName(const QString &text)
 //---------------------------------------------------------------------------------------------------------------------
 MainWindow::~MainWindow()
 {
+    WaitForAutoSave();
     CancelTool();
     CleanLayout();
 
@@ -6097,6 +6222,7 @@ MainWindow::~MainWindow()
  */
 bool MainWindow::LoadPattern(const QString &fileName, const QString& customMeasureFile)
 {
+    V_TRACE_SCOPE("MainWindow::LoadPattern", "parse");
     qCInfo(vMainWindow, "Loading new file %s.", qUtf8Printable(fileName));
 
     //We have unsaved changes or load more then one file per time
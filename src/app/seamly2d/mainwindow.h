@@ -60,6 +60,7 @@
 #include "core/vcmdexport.h"
 #include "../vmisc/vlockguard.h"
 
+#include <QFutureWatcher>
 #include <QPointer>
 #include <QSharedPointer>
 
@@ -266,6 +267,7 @@ private slots:
 
     void ChangedSize(int index);
     void ChangedHeight(int index);
+    void UpdateNextScenePreview();
 
 private:
     Q_DISABLE_COPY(MainWindow)
@@ -327,6 +329,12 @@ private slots:
     QLabel                           *leftGoToStage;
     QLabel                           *rightGoToStage;
     QTimer                           *autoSaveTimer;
+    QTimer                           *scenePreviewTimer;
+    int                               nextScenePreview;    /** @brief nextScenePreview index of sheet waiting for
+                                                            *  preview, -1 if all previews are ready. */
+    QFutureWatcher<bool>             *autoSaveWatcher;
+    bool                              autoSavePending;     /** @brief autoSavePending autosave requested while
+                                                            *  previous one was still writing. */
     bool                              guiEnabled;
     QPointer<QComboBox>               gradationHeights;
     QPointer<QComboBox>               gradationSizes;
@@ -402,6 +410,7 @@ private slots:
 
     bool               SavePattern(const QString &fileName, QString &error);
     void               AutoSavePattern();
+    void               WaitForAutoSave();
     void               setCurrentFile(const QString &fileName);
 
     void               ReadSettings();
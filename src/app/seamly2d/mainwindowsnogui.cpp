@@ -61,10 +61,12 @@
 #include "dialogs/dialoglayoutprogress.h"
 #include "dialogs/export_layout_dialog.h"
 #include "../vlayout/vposter.h"
+#include "../vlayout/vscenedisplaylist.h"
 #include "../vpatterndb/floatItemData/vpiecelabeldata.h"
 #include "../vpatterndb/floatItemData/vpatternlabeldata.h"
 #include "../vpatterndb/floatItemData/vgrainlinedata.h"
 #include "../vpatterndb/measurements_def.h"
+#include "../vmisc/vtrace.h"
 #include "../vtools/tools/vabstracttool.h"
 #include "../vtools/tools/pattern_piece_tool.h"
 
@@ -179,6 +181,7 @@ void MainWindowsNoGUI::toolLayoutSettings(QToolButton *tButton, bool checked)
 //---------------------------------------------------------------------------------------------------------------------
 bool MainWindowsNoGUI::LayoutSettings(VLayoutGenerator& lGenerator)
 {
+    V_TRACE_SCOPE("MainWindowsNoGUI::LayoutSettings", "layout");
     lGenerator.setPieces(pieceList);
     DialogLayoutProgress progress(pieceList.count(), this);
     if (VApplication::IsGUIMode())
@@ -254,6 +257,7 @@ void MainWindowsNoGUI::ErrorConsoleMode(const LayoutErrors &state)
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::ExportData(const QVector<VLayoutPiece> &pieceList, const ExportLayoutDialog &dialog)
 {
+    V_TRACE_SCOPE("MainWindowsNoGUI::ExportData", "export");
     const LayoutExportFormat format = dialog.format();
 
     if (format == LayoutExportFormat::DXF_AC1006_AAMA ||
@@ -597,6 +601,8 @@ void MainWindowsNoGUI::PrintPages(QPrinter *printer)
     }
 
     const int numPages = lastPage - firstPage + 1;
+    VSceneDisplayList sheet;
+    int recordedSheet = -1;
     int copyCount = 1;
     if (!printer->supportsMultipleCopies())
     {
@@ -612,6 +618,10 @@ void MainWindowsNoGUI::PrintPages(QPrinter *printer)
                 if (!printer->newPage())
                 {
                     qWarning("Failed in flushing page to disk, disk may be full.");
+                    if (recordedSheet != -1)
+                    {
+                        RestorePaper(recordedSheet);
+                    }
                     return;
                 }
             }
@@ -631,15 +641,28 @@ void MainWindowsNoGUI::PrintPages(QPrinter *printer)
             auto *paper = qgraphicsitem_cast<QGraphicsRectItem *>(papers.at(paperIndex));
             if (paper)
             {
+                if (recordedSheet != paperIndex)
+                {
+                    // Tiles of a sheet go one after another, record the sheet once and replay it for each tile.
+                    // Items are painted live, so the sheet stays prepared until we move to the next one.
+                    if (recordedSheet != -1)
+                    {
+                        RestorePaper(recordedSheet);
+                    }
+                    PreparePaper(paperIndex);
+                    sheet.Record(scenes.at(paperIndex));
+                    recordedSheet = paperIndex;
+                }
+
                 QVector<QGraphicsItem *> posterData;
+                VSceneDisplayList borders;
                 if (isTiled)
                 {
-                    // Draw borders
-                    posterData = posterazor->Borders(paper, poster->at(index), scenes.size());
+                    // Borders don't belong to the scene, they are painted over the paper
+                    posterData = posterazor->Borders(nullptr, poster->at(index), scenes.size());
+                    borders.Record(posterData);
                 }
 
-                PreparePaper(paperIndex);
-
                 // Render
                 QRectF source;
                 isTiled ? source = poster->at(index).rect : source = paper->rect();
@@ -658,20 +681,18 @@ void MainWindowsNoGUI::PrintPages(QPrinter *printer)
 
                 QRectF target(x * scale, y * scale, source.width() * scale, source.height() * scale);
 
-                scenes.at(paperIndex)->render(&painter, target, source, Qt::IgnoreAspectRatio);
+                sheet.Render(&painter, target, source, isTiled ? &borders : nullptr, paper);
 
-                if (isTiled)
-                {
-                    // Remove borders
-                    qDeleteAll(posterData);
-                }
-
-                // Restore
-                RestorePaper(paperIndex);
+                qDeleteAll(posterData);
             }
         }
     }
 
+    if (recordedSheet != -1)
+    {
+        RestorePaper(recordedSheet);
+    }
+
     painter.end();
 }
 
@@ -797,15 +818,27 @@ void MainWindowsNoGUI::InitTempLayoutScene()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QIcon MainWindowsNoGUI::ScenePreview(int i) const
+/**
+ * @brief ScenePreview render sheet preview.
+ *
+ * Sheet is rendered directly at icon resolution. Full size sheet can be thousands of pixels in each direction.
+ * @param i sheet index.
+ * @param iconSize maximal size of preview.
+ * @return preview icon.
+ */
+QIcon MainWindowsNoGUI::ScenePreview(int i, const QSize &iconSize) const
 {
     QImage image;
     QGraphicsRectItem *paper = qgraphicsitem_cast<QGraphicsRectItem *>(papers.at(i));
     if (paper)
     {
         const QRectF r = paper->rect();
-        // Create the image with the exact size of the shrunk scene
-        image = QImage(QSize(static_cast<qint32>(r.width()), static_cast<qint32>(r.height())), QImage::Format_RGB32);
+        QSize size(static_cast<qint32>(r.width()), static_cast<qint32>(r.height()));
+        if (size.width() > iconSize.width() || size.height() > iconSize.height())
+        {
+            size.scale(iconSize, Qt::KeepAspectRatio);
+        }
+        image = QImage(size, QImage::Format_RGB32);
 
         if (!image.isNull())
         {
@@ -815,7 +848,7 @@ QIcon MainWindowsNoGUI::ScenePreview(int i) const
             painter.setRenderHint(QPainter::Antialiasing, true);
             painter.setPen(QPen(Qt::black, widthMainLine, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
             painter.setBrush ( QBrush ( Qt::NoBrush ) );
-            scenes.at(i)->render(&painter, r, r, Qt::IgnoreAspectRatio);
+            scenes.at(i)->render(&painter, QRectF(QPointF(0, 0), size), r, Qt::IgnoreAspectRatio);
             painter.end();
         }
         else
@@ -828,7 +861,32 @@ QIcon MainWindowsNoGUI::ScenePreview(int i) const
         image = QImage(QSize(101, 146), QImage::Format_RGB32);
         image.fill(Qt::white);
     }
-    return QIcon(QBitmap::fromImage(image));
+    return QIcon(QPixmap::fromImage(image));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ScenePreviewPlaceholder blank preview with sheet proportions, shown until real preview is ready.
+ * @param i sheet index.
+ * @param iconSize maximal size of preview.
+ * @return blank icon.
+ */
+QIcon MainWindowsNoGUI::ScenePreviewPlaceholder(int i, const QSize &iconSize) const
+{
+    QSize size(101, 146);
+    QGraphicsRectItem *paper = qgraphicsitem_cast<QGraphicsRectItem *>(papers.at(i));
+    if (paper)
+    {
+        size = paper->rect().size().toSize();
+        if (size.width() > iconSize.width() || size.height() > iconSize.height())
+        {
+            size.scale(iconSize, Qt::KeepAspectRatio);
+        }
+    }
+
+    QPixmap pixmap(size);
+    pixmap.fill(Qt::white);
+    return QIcon(pixmap);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1051,6 +1109,7 @@ void MainWindowsNoGUI::exportPDF(const QString &name, QGraphicsRectItem *paper,
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::PdfTiledFile(const QString &name)
 {
+    V_TRACE_SCOPE("MainWindowsNoGUI::PdfTiledFile", "export");
     isTiled = true;
 
     if (isLayoutStale)
@@ -1147,6 +1206,7 @@ void MainWindowsNoGUI::convertPdfToPs(const QStringList &params) const
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::ObjFile(const QString &name, QGraphicsRectItem *paper, QGraphicsScene *scene) const
 {
+    V_TRACE_SCOPE("MainWindowsNoGUI::ObjFile", "export");
     VObjPaintDevice generator;
     generator.setFileName(name);
     generator.setSize(paper->rect().size().toSize());
@@ -1164,6 +1224,7 @@ QT_WARNING_DISABLE_GCC("-Wswitch-default")
 void MainWindowsNoGUI::FlatDxfFile(const QString &name, int version, bool binary, QGraphicsRectItem *paper,
                                QGraphicsScene *scene, const QList<QList<QGraphicsItem *> > &pieces) const
 {
+    V_TRACE_SCOPE("MainWindowsNoGUI::FlatDxfFile", "export");
     PrepareTextForDXF(endStringPlaceholder, pieces);
     VDxfPaintDevice generator;
     generator.setFileName(name);
@@ -1186,6 +1247,7 @@ void MainWindowsNoGUI::FlatDxfFile(const QString &name, int version, bool binary
 void MainWindowsNoGUI::AAMADxfFile(const QString &name, int version, bool binary, const QSize &size,
                                    const QVector<VLayoutPiece> &pieces) const
 {
+    V_TRACE_SCOPE("MainWindowsNoGUI::AAMADxfFile", "export");
     VDxfPaintDevice generator;
     generator.setFileName(name);
     generator.setSize(size);
@@ -1606,6 +1668,7 @@ void MainWindowsNoGUI::ExportScene(const ExportLayoutDialog &dialog, const QList
                                    const QList<QList<QGraphicsItem *> > &pieces, bool ignoreMargins,
                                    const QMarginsF &margins) const
 {
+    V_TRACE_SCOPE("MainWindowsNoGUI::ExportScene", "export");
     for (int i=0; i < scenes.size(); ++i)
     {
         QString increment  = QStringLiteral("");
@@ -130,7 +130,8 @@ public slots:
     void         InitTempLayoutScene();
     virtual void CleanLayout()=0;
     virtual void PrepareSceneList()=0;
-    QIcon        ScenePreview(int i) const;
+    QIcon        ScenePreview(int i, const QSize &iconSize) const;
+    QIcon        ScenePreviewPlaceholder(int i, const QSize &iconSize) const;
     bool         LayoutSettings(VLayoutGenerator& lGenerator);
     int          ContinueIfLayoutStale();
     QString      FileName() const;
@@ -68,6 +68,7 @@
 #include "../vmisc/vmath.h"
 #include "../vmisc/projectversion.h"
 #include "../vmisc/vabstractapplication.h"
+#include "../vmisc/vtrace.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "../qmuparser/qmutokenparser.h"
 #include "../vgeometry/varc.h"
@@ -159,6 +160,7 @@ void VPattern::setXMLContent(const QString &fileName)
  */
 void VPattern::Parse(const Document &parse)
 {
+    V_TRACE_SCOPE("VPattern::Parse", "parse");
     qCDebug(vXML, "Parsing pattern.");
     switch (parse)
     {
@@ -287,13 +289,10 @@ void VPattern::setCurrentData()
                 qCDebug(vXML, "History is empty!");
                 return;
             }
-            for (qint32 i = 0; i < history.size(); ++i)
+            const QVector<VToolRecord> records = getBlockHistory();
+            if (not records.isEmpty())
             {
-                const VToolRecord tool = history.at(i);
-                if (tool.getDraftBlockName() == activeDraftBlock)
-                {
-                    id = tool.getId();
-                }
+                id = records.last().getId();
             }
             qCDebug(vXML, "Resoring data from tool with id %u", id);
             if (id == NULL_ID)
@@ -437,6 +436,39 @@ bool VPattern::SaveDocument(const QString &fileName, QString &error)
     return saved;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AutoSaveSnapshot make deep copy of the pattern ready for saving.
+ *
+ * The copy doesn't share data with the document, so it can be written in another thread while user continues editing.
+ * @return copy of the document or null document if pattern is not valid for saving.
+ */
+QDomDocument VPattern::AutoSaveSnapshot() const
+{
+    try
+    {
+        TestUniqueId();
+    }
+    catch (const VExceptionWrongId &error)
+    {
+        qCCritical(vXML, "%s\n\n%s\n\n%s", qUtf8Printable(tr("Error not unique id.")),
+                   qUtf8Printable(error.ErrorMessage()), qUtf8Printable(error.DetailedInformation()));
+        return QDomDocument();
+    }
+
+    QDomDocument snapshot = cloneNode(true).toDocument();
+
+    // Update comment with Seamly2D version
+    QDomNode commentNode = snapshot.documentElement().firstChild();
+    if (commentNode.isComment())
+    {
+        QDomComment comment = commentNode.toComment();
+        comment.setData(FileComment());
+    }
+
+    return snapshot;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::LiteParseIncrements()
 {
@@ -514,6 +546,7 @@ void VPattern::LiteParseIncrements()
  */
 void VPattern::LiteParseTree(const Document &parse)
 {
+    V_TRACE_SCOPE("VPattern::LiteParseTree", "parse");
     // Save current draft block name
     QString draftBlockName = activeDraftBlock;
 
@@ -683,6 +716,7 @@ VNodeDetail VPattern::parsePieceNode(const QDomElement &domElement) const
  */
 void VPattern::parseDraftBlockElement(const QDomNode &node, const Document &parse)
 {
+    V_TRACE_SCOPE("VPattern::parseDraftBlockElement", "parse");
     QStringList tags = QStringList() << TagCalculation << TagModeling << TagPieces << TagGroups;
     QDomNode domNode = node.firstChild();
     while (domNode.isNull() == false)
@@ -806,6 +840,7 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
  */
 void VPattern::parsePieceElement(QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("VPattern::parsePieceElement", "parse");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     try
     {
@@ -3931,7 +3966,7 @@ void VPattern::PrepareForParse(const Document &parse)
 
         tools.clear();
         cursor = 0;
-        history.clear();
+        clearHistory();
     }
     else if (parse == Document::LiteParse)
     {
@@ -3963,84 +3998,82 @@ QRectF VPattern::ActiveDrawBoundingRect() const
 
     QRectF rect;
 
-    for (qint32 i = 0; i< history.size(); ++i)
+    const QVector<VToolRecord> records = getBlockHistory();
+    for (qint32 i = 0; i< records.size(); ++i)
     {
-        const VToolRecord tool = history.at(i);
-        if (tool.getDraftBlockName() == activeDraftBlock)
+        const VToolRecord &tool = records.at(i);
+        switch ( tool.getTypeTool() )
         {
-            switch ( tool.getTypeTool() )
-            {
-                case Tool::Arrow:
-                case Tool::SinglePoint:
-                case Tool::DoublePoint:
-                case Tool::LinePoint:
-                case Tool::AbstractSpline:
-                case Tool::Cut:
-                case Tool::Midpoint:// Same as Tool::AlongLine, but tool will never has such type
-                case Tool::ArcIntersectAxis:// Same as Tool::CurveIntersectAxis, but tool will never has such type
-                case Tool::LAST_ONE_DO_NOT_USE:
-                    Q_UNREACHABLE();
-                    break;
-                case Tool::BasePoint:
-                case Tool::LineIntersect:
-                case Tool::PointOfContact:
-                case Tool::Triangle:
-                case Tool::PointOfIntersection:
-                case Tool::CutArc:
-                case Tool::CutSpline:
-                case Tool::CutSplinePath:
-                case Tool::PointOfIntersectionArcs:
-                case Tool::PointOfIntersectionCircles:
-                case Tool::PointOfIntersectionCurves:
-                case Tool::PointFromCircleAndTangent:
-                case Tool::PointFromArcAndTangent:
-                    rect = ToolBoundingRect<VToolSinglePoint>(rect, tool.getId());
-                    break;
-                case Tool::EndLine:
-                case Tool::AlongLine:
-                case Tool::ShoulderPoint:
-                case Tool::Normal:
-                case Tool::Bisector:
-                case Tool::Height:
-                case Tool::LineIntersectAxis:
-                case Tool::CurveIntersectAxis:
-                    rect = ToolBoundingRect<VToolLinePoint>(rect, tool.getId());
-                    break;
-                case Tool::Line:
-                    rect = ToolBoundingRect<VToolLine>(rect, tool.getId());
-                    break;
-                case Tool::Spline:
-                case Tool::CubicBezier:
-                case Tool::Arc:
-                case Tool::SplinePath:
-                case Tool::CubicBezierPath:
-                case Tool::ArcWithLength:
-                case Tool::EllipticalArc:
-                    rect = ToolBoundingRect<VAbstractSpline>(rect, tool.getId());
-                    break;
-                case Tool::TrueDarts:
-                    rect = ToolBoundingRect<VToolDoublePoint>(rect, tool.getId());
-                    break;
-                case Tool::Rotation:
-                case Tool::MirrorByLine:
-                case Tool::MirrorByAxis:
-                case Tool::Move:
-                    rect = ToolBoundingRect<VAbstractOperation>(rect, tool.getId());
-                    break;
-                //These tools are not accesseble in Draw mode, but still 'history' contains them.
-                case Tool::Piece:
-                case Tool::Union:
-                case Tool::NodeArc:
-                case Tool::NodeElArc:
-                case Tool::NodePoint:
-                case Tool::NodeSpline:
-                case Tool::NodeSplinePath:
-                case Tool::Group:
-                case Tool::InternalPath:
-                case Tool::AnchorPoint:
-                case Tool::InsertNodes:
-                    break;
-            }
+            case Tool::Arrow:
+            case Tool::SinglePoint:
+            case Tool::DoublePoint:
+            case Tool::LinePoint:
+            case Tool::AbstractSpline:
+            case Tool::Cut:
+            case Tool::Midpoint:// Same as Tool::AlongLine, but tool will never has such type
+            case Tool::ArcIntersectAxis:// Same as Tool::CurveIntersectAxis, but tool will never has such type
+            case Tool::LAST_ONE_DO_NOT_USE:
+                Q_UNREACHABLE();
+                break;
+            case Tool::BasePoint:
+            case Tool::LineIntersect:
+            case Tool::PointOfContact:
+            case Tool::Triangle:
+            case Tool::PointOfIntersection:
+            case Tool::CutArc:
+            case Tool::CutSpline:
+            case Tool::CutSplinePath:
+            case Tool::PointOfIntersectionArcs:
+            case Tool::PointOfIntersectionCircles:
+            case Tool::PointOfIntersectionCurves:
+            case Tool::PointFromCircleAndTangent:
+            case Tool::PointFromArcAndTangent:
+                rect = ToolBoundingRect<VToolSinglePoint>(rect, tool.getId());
+                break;
+            case Tool::EndLine:
+            case Tool::AlongLine:
+            case Tool::ShoulderPoint:
+            case Tool::Normal:
+            case Tool::Bisector:
+            case Tool::Height:
+            case Tool::LineIntersectAxis:
+            case Tool::CurveIntersectAxis:
+                rect = ToolBoundingRect<VToolLinePoint>(rect, tool.getId());
+                break;
+            case Tool::Line:
+                rect = ToolBoundingRect<VToolLine>(rect, tool.getId());
+                break;
+            case Tool::Spline:
+            case Tool::CubicBezier:
+            case Tool::Arc:
+            case Tool::SplinePath:
+            case Tool::CubicBezierPath:
+            case Tool::ArcWithLength:
+            case Tool::EllipticalArc:
+                rect = ToolBoundingRect<VAbstractSpline>(rect, tool.getId());
+                break;
+            case Tool::TrueDarts:
+                rect = ToolBoundingRect<VToolDoublePoint>(rect, tool.getId());
+                break;
+            case Tool::Rotation:
+            case Tool::MirrorByLine:
+            case Tool::MirrorByAxis:
+            case Tool::Move:
+                rect = ToolBoundingRect<VAbstractOperation>(rect, tool.getId());
+                break;
+            //These tools are not accesseble in Draw mode, but still 'history' contains them.
+            case Tool::Piece:
+            case Tool::Union:
+            case Tool::NodeArc:
+            case Tool::NodeElArc:
+            case Tool::NodePoint:
+            case Tool::NodeSpline:
+            case Tool::NodeSplinePath:
+            case Tool::Group:
+            case Tool::InternalPath:
+            case Tool::AnchorPoint:
+            case Tool::InsertNodes:
+                break;
         }
     }
     return rect;
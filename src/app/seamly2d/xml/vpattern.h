@@ -87,6 +87,7 @@ class VPattern : public VAbstractPattern
 
     virtual void   setXMLContent(const QString &fileName) Q_DECL_OVERRIDE;
     virtual bool   SaveDocument(const QString &fileName, QString &error) Q_DECL_OVERRIDE;
+    QDomDocument   AutoSaveSnapshot() const;
 
     QRectF         ActiveDrawBoundingRect() const;
 
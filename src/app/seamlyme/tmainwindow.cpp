@@ -136,7 +136,8 @@ TMainWindow::TMainWindow(QWidget *parent)
 	  mIsReadOnly(false),
 	  recentFileActs(),
 	  separatorAct(nullptr),
-	  hackedWidgets()
+	  hackedWidgets(),
+	  m_rows()
 {
 	ui->setupUi(this);
 
@@ -1707,21 +1708,17 @@ void TMainWindow::ImportFromPattern()
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::ChangedSize(int index)
 {
-	const int row = ui->tableWidget->currentRow();
     currentSize = gradationSizes->itemText(index).toInt();
-	RefreshData();
+	RefreshGradedValues();
 	search->RefreshList(ui->lineEditFind->text());
-	ui->tableWidget->selectRow(row);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::ChangedHeight(int index)
 {
-	const int row = ui->tableWidget->currentRow();
     currentHeight = gradationHeights->itemText(index).toInt();
-	RefreshData();
+	RefreshGradedValues();
 	search->RefreshList(ui->lineEditFind->text());
-	ui->tableWidget->selectRow(row);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1985,7 +1982,7 @@ void TMainWindow::SaveMValue()
 
 	const QTextCursor cursor = ui->plainTextEditFormula->textCursor();
 
-	RefreshData();
+	RefreshMeasurement(nameField->data(Qt::UserRole).toString());
 	search->RefreshList(ui->lineEditFind->text());
 
 	ui->tableWidget->blockSignals(true);
@@ -2010,7 +2007,7 @@ void TMainWindow::SaveMBaseValue(double value)
 
 	MeasurementsWasSaved(false);
 
-	RefreshData();
+	RefreshMeasurement(nameField->data(Qt::UserRole).toString());
 	search->RefreshList(ui->lineEditFind->text());
 
 	ui->tableWidget->blockSignals(true);
@@ -2035,7 +2032,7 @@ void TMainWindow::SaveMSizeIncrease(double value)
 
 	MeasurementsWasSaved(false);
 
-	RefreshData();
+	RefreshMeasurement(nameField->data(Qt::UserRole).toString());
 	search->RefreshList(ui->lineEditFind->text());
 
 	ui->tableWidget->blockSignals(true);
@@ -2060,7 +2057,7 @@ void TMainWindow::SaveMHeightIncrease(double value)
 
 	MeasurementsWasSaved(false);
 
-	RefreshData();
+	RefreshMeasurement(nameField->data(Qt::UserRole).toString());
 	search->RefreshList(ui->lineEditFind->text());
 
 	ui->tableWidget->blockSignals(true);
@@ -2087,7 +2084,7 @@ void TMainWindow::SaveMDescription()
 
 	const QTextCursor cursor = ui->plainTextEditDescription->textCursor();
 
-	RefreshData();
+	RefreshMeasurement(nameField->data(Qt::UserRole).toString());
 
 	ui->tableWidget->blockSignals(true);
 	ui->tableWidget->selectRow(row);
@@ -2131,7 +2128,7 @@ void TMainWindow::SaveMFullName()
 
 		MeasurementsWasSaved(false);
 
-		RefreshData();
+		RefreshMeasurement(nameField->data(Qt::UserRole).toString());
 
 		ui->tableWidget->blockSignals(true);
 		ui->tableWidget->selectRow(row);
@@ -2659,6 +2656,7 @@ void TMainWindow::RefreshTable(bool freshCall)
 {
 	ui->tableWidget->blockSignals(true);
 	ui->tableWidget->clearContents();
+	m_rows.clear();
 
 	ShowUnits();
 
@@ -2676,88 +2674,147 @@ void TMainWindow::RefreshTable(bool freshCall)
 	ui->tableWidget->setRowCount ( orderedTable.size() );
 	for (iMap = orderedTable.constBegin(); iMap != orderedTable.constEnd(); ++iMap)
 	{
-		QSharedPointer<MeasurementVariable> meash = iMap.value();
 		currentRow++;
+		m_rows.insert(iMap.value()->GetName(), currentRow);
+		FillRow(currentRow, iMap.value());
+	}
 
-		if (mType == MeasurementsType::Individual)
+	if (freshCall)
+	{
+		ui->tableWidget->resizeColumnsToContents();
+		ui->tableWidget->resizeRowsToContents();
+	}
+	ui->tableWidget->horizontalHeader()->setStretchLastSection(true);
+	ui->tableWidget->blockSignals(false);
+
+	if (ui->tableWidget->rowCount() > 0)
+	{
+		ui->actionExportToCSV->setEnabled(true);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TMainWindow::FillRow(int row, const QSharedPointer<MeasurementVariable> &meash)
+{
+	if (mType == MeasurementsType::Individual)
+	{
+		QTableWidgetItem *item = AddCell(qApp->TrVars()->MToUser(meash->GetName()), row, ColumnName,
+										 Qt::AlignVCenter); // name
+		item->setData(Qt::UserRole, meash->GetName());
+
+		if (meash->isCustom())
+		{
+            AddCell(QStringLiteral("na"), row, ColumnNumber, Qt::AlignVCenter);
+			AddCell(meash->getGuiText(), row, ColumnFullName, Qt::AlignVCenter);
+		}
+		else
 		{
-			QTableWidgetItem *item = AddCell(qApp->TrVars()->MToUser(meash->GetName()), currentRow, ColumnName,
-											 Qt::AlignVCenter); // name
-			item->setData(Qt::UserRole, meash->GetName());
 
-			if (meash->isCustom())
-			{
-                AddCell(QStringLiteral("na"), currentRow, ColumnNumber, Qt::AlignVCenter);
-				AddCell(meash->getGuiText(), currentRow, ColumnFullName, Qt::AlignVCenter);
-			}
-			else
-			{
+			AddCell(getMeasurementNumber(meash->GetName()), row, ColumnNumber, Qt::AlignVCenter);
+            AddCell(qApp->TrVars()->guiText(meash->GetName()), row, ColumnFullName, Qt::AlignVCenter);
+		}
 
-				AddCell(getMeasurementNumber(meash->GetName()), currentRow, ColumnNumber, Qt::AlignVCenter);
-                AddCell(qApp->TrVars()->guiText(meash->GetName()), currentRow, ColumnFullName, Qt::AlignVCenter);
-			}
+		const qreal value = UnitConvertor(*meash->GetValue(), mUnit, pUnit);
+		AddCell(locale().toString(value), row, ColumnCalcValue, Qt::AlignHCenter | Qt::AlignVCenter,
+				meash->IsFormulaOk()); // calculated value
 
-			const qreal value = UnitConvertor(*meash->GetValue(), mUnit, pUnit);
-			AddCell(locale().toString(value), currentRow, ColumnCalcValue, Qt::AlignHCenter | Qt::AlignVCenter,
-					meash->IsFormulaOk()); // calculated value
+		QString formula;
+		try
+		{
+			formula = qApp->TrVars()->FormulaToUser(meash->GetFormula(), qApp->Settings()->GetOsSeparator());
+		}
+		catch (qmu::QmuParserError &error)
+		{
+			Q_UNUSED(error)
+			formula = meash->GetFormula();
+		}
 
-			QString formula;
-			try
-			{
-				formula = qApp->TrVars()->FormulaToUser(meash->GetFormula(), qApp->Settings()->GetOsSeparator());
-			}
-			catch (qmu::QmuParserError &error)
-			{
-				Q_UNUSED(error)
-				formula = meash->GetFormula();
-			}
+		AddCell(formula, row, ColumnFormula, Qt::AlignVCenter); // formula
+	}
+	else
+	{
+		QTableWidgetItem *item = AddCell(qApp->TrVars()->MToUser(meash->GetName()), row, 0,
+										 Qt::AlignVCenter); // name
+		item->setData(Qt::UserRole, meash->GetName());
 
-			AddCell(formula, currentRow, ColumnFormula, Qt::AlignVCenter); // formula
+		if (meash->isCustom())
+		{
+			AddCell(QStringLiteral("na"), row, ColumnNumber, Qt::AlignVCenter);
+            AddCell(meash->getGuiText(), row, ColumnFullName, Qt::AlignVCenter);
 		}
 		else
 		{
-			QTableWidgetItem *item = AddCell(qApp->TrVars()->MToUser(meash->GetName()), currentRow, 0,
-											 Qt::AlignVCenter); // name
-			item->setData(Qt::UserRole, meash->GetName());
+			AddCell(getMeasurementNumber(meash->GetName()), row, ColumnNumber, Qt::AlignVCenter);
+            AddCell(qApp->TrVars()->guiText(meash->GetName()), row, ColumnFullName, Qt::AlignVCenter);
+		}
 
-			if (meash->isCustom())
-			{
-				AddCell(QStringLiteral("na"), currentRow, ColumnNumber, Qt::AlignVCenter);
-                AddCell(meash->getGuiText(), currentRow, ColumnFullName, Qt::AlignVCenter);
-			}
-			else
-			{
-				AddCell(getMeasurementNumber(meash->GetName()), currentRow, ColumnNumber, Qt::AlignVCenter);
-                AddCell(qApp->TrVars()->guiText(meash->GetName()), currentRow, ColumnFullName, Qt::AlignVCenter);
-			}
+		const qreal value = UnitConvertor(*data->DataVariables()->value(meash->GetName())->GetValue(), mUnit,
+										  pUnit);
+		AddCell(locale().toString(value), row, ColumnCalcValue,
+				Qt::AlignHCenter | Qt::AlignVCenter, meash->IsFormulaOk()); // calculated value
 
-			const qreal value = UnitConvertor(*data->DataVariables()->value(meash->GetName())->GetValue(), mUnit,
-											  pUnit);
-			AddCell(locale().toString(value), currentRow, ColumnCalcValue,
-					Qt::AlignHCenter | Qt::AlignVCenter, meash->IsFormulaOk()); // calculated value
+		AddCell(locale().toString(meash->GetBase()), row, ColumnBaseValue,
+				Qt::AlignHCenter | Qt::AlignVCenter); // base value
 
-			AddCell(locale().toString(meash->GetBase()), currentRow, ColumnBaseValue,
-					Qt::AlignHCenter | Qt::AlignVCenter); // base value
+		AddCell(locale().toString(meash->GetKsize()), row, ColumnInSizes,
+				Qt::AlignHCenter | Qt::AlignVCenter); // in sizes
 
-			AddCell(locale().toString(meash->GetKsize()), currentRow, ColumnInSizes,
-					Qt::AlignHCenter | Qt::AlignVCenter); // in sizes
+		AddCell(locale().toString(meash->GetKheight()), row, ColumnInHeights,
+				Qt::AlignHCenter | Qt::AlignVCenter); // in heights
+	}
+}
 
-			AddCell(locale().toString(meash->GetKheight()), currentRow, ColumnInHeights,
-					Qt::AlignHCenter | Qt::AlignVCenter); // in heights
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshMeasurement update the table after a single measurement was changed.
+ *
+ * Only the changed measurement and measurements that depend on it are evaluated again, only their rows are refilled.
+ *
+ * @param name internal name of the changed measurement.
+ */
+void TMainWindow::RefreshMeasurement(const QString &name)
+{
+	const QStringList updated = individualMeasurements->updateMeasurement(name);
+	const QMap<QString, QSharedPointer<MeasurementVariable> > table = data->DataMeasurements();
+
+	ui->tableWidget->blockSignals(true);
+	for (int i = 0; i < updated.size(); ++i)
+	{
+		if (m_rows.contains(updated.at(i)) && table.contains(updated.at(i)))
+		{
+			FillRow(m_rows.value(updated.at(i)), table.value(updated.at(i)));
 		}
 	}
+	ui->tableWidget->blockSignals(false);
+}
 
-	if (freshCall)
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshGradedValues update calculated values of a multisize table after the size or the height was changed.
+ *
+ * The file is not read again, values of all measurements are taken from one grading table pass.
+ */
+void TMainWindow::RefreshGradedValues()
+{
+	const QHash<QString, QVector<qreal> > values = data->gradingTable(QVector<qreal>{currentSize},
+																	   QVector<qreal>{currentHeight});
+
+	ui->tableWidget->blockSignals(true);
+	QHash<QString, int>::const_iterator i;
+	for (i = m_rows.constBegin(); i != m_rows.constEnd(); ++i)
 	{
-		ui->tableWidget->resizeColumnsToContents();
-		ui->tableWidget->resizeRowsToContents();
+		const QVector<qreal> column = values.value(i.key());
+		QTableWidgetItem *item = ui->tableWidget->item(i.value(), ColumnCalcValue);
+		if (not column.isEmpty() && item != nullptr)
+		{
+			item->setText(locale().toString(UnitConvertor(column.first(), mUnit, pUnit)));
+		}
 	}
-	ui->tableWidget->horizontalHeader()->setStretchLastSection(true);
 	ui->tableWidget->blockSignals(false);
 
-	if (ui->tableWidget->rowCount() > 0)
+	if (ui->tableWidget->currentRow() != -1)
 	{
-		ui->actionExportToCSV->setEnabled(true);
+		ShowNewMData(false);
 	}
 }
 
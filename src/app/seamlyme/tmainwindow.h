@@ -56,6 +56,8 @@
 #ifndef TMAINWINDOW_H
 #define TMAINWINDOW_H
 
+#include <QHash>
+#include <QSharedPointer>
 #include <QTableWidget>
 
 #include "../vmisc/def.h"
@@ -72,6 +74,7 @@ namespace Ui
 class QLabel;
 class MeShortcutsDialog;
 class MeasurementDoc;
+class MeasurementVariable;
 class VContainer;
 
 class TMainWindow : public VAbstractMainWindow
@@ -191,6 +194,7 @@ private slots:
     QAction            *recentFileActs[MaxRecentFiles];
     QAction            *separatorAct;
     QVector<QObject *>  hackedWidgets;
+    QHash<QString, int> m_rows;
 
     void                SetupMenu();
     void                InitWindow();
@@ -220,6 +224,9 @@ private slots:
 
     void                RefreshData(bool freshCall = false);
     void                RefreshTable(bool freshCall = false);
+    void                RefreshMeasurement(const QString &name);
+    void                RefreshGradedValues();
+    void                FillRow(int row, const QSharedPointer<MeasurementVariable> &meash);
 
     QString             GetCustomName() const;
     QString             ClearCustomName(const QString &name) const;
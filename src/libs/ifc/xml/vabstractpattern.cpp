@@ -265,8 +265,13 @@ VAbstractPattern::VAbstractPattern(QObject *parent)
     , cursor(0)
     , toolsOnRemove(QVector<VDataTool*>())
     , history(QVector<VToolRecord>())
+    , blockHistory()
+    , historyIndex()
     , patternPieces(QStringList())
     , modified(false)
+    , groupIndex()
+    , groupIndexBlock()
+    , groupIndexValid(false)
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -446,6 +451,8 @@ void VAbstractPattern::parseGroups(const QDomElement &domElement)
 {
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
+    groupIndexValid = false; // The groups were changed outside of the index, rebuild it on next query
+
     QMap<quint32, quint32> itemTool;
     QMap<quint32, bool> itemVisibility;
 
@@ -562,6 +569,24 @@ bool VAbstractPattern::renameDraftBlock(const QString &oldName, const QString &n
             activeDraftBlock = newName;
         }
         ppElement.setAttribute(AttrName, newName);
+
+        if (blockHistory.contains(oldName))
+        {
+            QVector<VToolRecord> records = blockHistory.take(oldName);
+            for (int i = 0; i < records.size(); ++i)
+            {
+                records[i].setNameDraw(newName);
+            }
+            blockHistory.insert(newName, records);
+
+            for (int i = 0; i < history.size(); ++i)
+            {
+                if (history.at(i).getDraftBlockName() == oldName)
+                {
+                    history[i].setNameDraw(newName);
+                }
+            }
+        }
         emit patternChanged(false);//For situation when we change name directly, without undocommands.
         emit draftBlockNameChanged(oldName, newName);
         return true;
@@ -838,40 +863,103 @@ void VAbstractPattern::AddToolOnRemove(VDataTool *tool)
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief getHistory return list with list of history records.
- * @return list of history records.
+ * @return list of history records of all draft blocks in order they were added.
  */
-QVector<VToolRecord> *VAbstractPattern::getHistory()
+const QVector<VToolRecord> &VAbstractPattern::getHistory() const
 {
-    return &history;
+    return history;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getBlockHistory return history records of the active draft block.
+ *
+ * Records are stored per draft block, so the returned vector is an implicitly shared copy and no records are copied.
+ */
 QVector<VToolRecord> VAbstractPattern::getBlockHistory() const
 {
-    QVector<VToolRecord> draftBlockHistory;
-    for (qint32 i = 0; i< history.size(); ++i)
+    return getBlockHistory(activeDraftBlock);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getBlockHistory return history records of a draft block.
+ * @param blockName draft block name.
+ * @return history records in draft block order.
+ */
+QVector<VToolRecord> VAbstractPattern::getBlockHistory(const QString &blockName) const
+{
+    return blockHistory.value(blockName);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief historyRecordIndex return position of a tool record in the history of its draft block.
+ * @param id tool id.
+ * @return position of the record or -1 if there is no record for the tool.
+ */
+int VAbstractPattern::historyRecordIndex(quint32 id) const
+{
+    return historyIndex.value(id, -1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief addHistoryRecord add record about tool in history.
+ * @param record tool record.
+ * @param afterId id of the tool after which the record will be placed in its draft block. If NULL_ID the record will
+ * be appended.
+ * @return false if history already has a record for this tool.
+ */
+bool VAbstractPattern::addHistoryRecord(const VToolRecord &record, quint32 afterId)
+{
+    if (historyIndex.contains(record.getId()))
     {
-        const VToolRecord tool = history.at(i);
-        if (tool.getDraftBlockName() != getActiveDraftBlockName())
+        return false;
+    }
+
+    QVector<VToolRecord> &records = blockHistory[record.getDraftBlockName()];
+
+    int position = records.size();
+    if (afterId != NULL_ID)
+    {
+        const int afterIndex = historyIndex.value(afterId, -1);
+        if (afterIndex >= 0 && afterIndex < records.size() && records.at(afterIndex).getId() == afterId)
         {
-            continue;
+            position = afterIndex + 1;
+        }
+        else
+        {
+            position = qMin(1, records.size());
         }
-        draftBlockHistory.append(tool);
     }
-    return draftBlockHistory;
+
+    records.insert(position, record);
+    for (int i = position; i < records.size(); ++i)
+    {
+        historyIndex.insert(records.at(i).getId(), i);
+    }
+
+    history.append(record);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VAbstractPattern::clearHistory()
+{
+    history.clear();
+    blockHistory.clear();
+    historyIndex.clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QMap<quint32, Tool> VAbstractPattern::getGroupObjHistory() const
 {
     QMap<quint32, Tool> draftBlockHistory;
-    for (qint32 i = 0; i< history.size(); ++i)
+    const QVector<VToolRecord> records = getBlockHistory();
+    for (qint32 i = 0; i< records.size(); ++i)
     {
-        const VToolRecord tool = history.at(i);
-        if (tool.getDraftBlockName() != getActiveDraftBlockName())
-        {
-            continue;
-        }
+        const VToolRecord &tool = records.at(i);
         draftBlockHistory.insert(tool.getId(), tool.getTypeTool());
     }
     return draftBlockHistory;
@@ -903,7 +991,8 @@ quint32 VAbstractPattern::SiblingNodeId(const quint32 &nodeId) const
     quint32 siblingId = NULL_ID;
 
     const QVector<VToolRecord> history = getBlockHistory();
-    for (qint32 i = 0; i < history.size(); ++i)
+    const qint32 i = historyRecordIndex(nodeId);
+    if (i >= 0 && i < history.size())
     {
         const VToolRecord tool = history.at(i);
         if (nodeId == tool.getId())
@@ -2256,6 +2345,7 @@ QDomElement VAbstractPattern::addGroupItems(const QString &name, const QMap<quin
                 item.setAttribute(AttrObject, i.key());
                 item.setAttribute(AttrTool, i.value());
                 group.appendChild(item);
+                getGroupIndex().AddItem(groupId, i.value(), i.key());
                 ++i;
             }
             modified = true;
@@ -2543,36 +2633,19 @@ QMap<quint32, QString> VAbstractPattern::getGroupsContainingItem(quint32 toolId,
         objectId = toolId;
     }
 
-    QDomElement groups = createGroups();
-    if (not groups.isNull())
+    const VGroupIndex &index = getGroupIndex();
+    const QVector<quint32> groups = containsItem ? index.GroupsOf(toolId, objectId) : index.Groups();
+    for (auto groupId : groups)
     {
-        QDomNode domNode = groups.firstChild();
-        while (domNode.isNull() == false) // iterate through the groups
+        if (containsItem || not index.Contains(groupId, toolId, objectId))
         {
-            if (domNode.isElement())
+            const QDomElement group = elementById(groupId, TagGroup);
+            if (group.isElement())
             {
-                const QDomElement group = domNode.toElement();
-                if (group.isNull() == false)
-                {
-                    if (group.tagName() == TagGroup)
-                    {
-                        bool groupHasItem = hasGroupItem(group, toolId, objectId);
-                        if((containsItem && groupHasItem) || (not containsItem && not groupHasItem))
-                        {
-                            const quint32 groupId = GetParametrUInt(group, AttrId, "0");
-                            const QString name = GetParametrString(group, AttrName, tr("New group"));
-                            data.insert(groupId, name);
-                        }
-                    }
-                }
+                data.insert(groupId, GetParametrString(group, AttrName, tr("New group")));
             }
-            domNode = domNode.nextSibling();
         }
     }
-    else
-    {
-        qDebug("Can't get tag Groups.");
-    }
 
     return data;
 }
@@ -2586,29 +2659,8 @@ QMap<quint32, QString> VAbstractPattern::getGroupsContainingItem(quint32 toolId,
  */
 bool VAbstractPattern::hasGroupItem(const QDomElement &groupDomElement, quint32 toolId, quint32 objectId)
 {
-    bool result = false;
-
-    QDomNode itemNode = groupDomElement.firstChild();
-    while (itemNode.isNull() == false) // iterate through the items of the group
-    {
-        if (itemNode.isElement())
-        {
-            const QDomElement item = itemNode.toElement();
-            if (item.isNull() == false)
-            {
-                quint32 toolIdIterate= GetParametrUInt(item, AttrTool, "0");
-                quint32 objectIdIterate= GetParametrUInt(item, AttrObject, "0");
-
-                if(toolIdIterate == toolId && objectIdIterate == objectId)
-                {
-                    result = true;
-                    break;
-                }
-            }
-        }
-        itemNode = itemNode.nextSibling();
-    }
-    return result;
+    const quint32 groupId = GetParametrUInt(groupDomElement, AttrId, "0");
+    return getGroupIndex().Contains(groupId, toolId, objectId);
 }
 
 /**
@@ -2666,11 +2718,6 @@ void VAbstractPattern::addToolToGroup(quint32 toolId, quint32 objectId, const QS
             modified = true;
             emit patternChanged(false);
             emit updateGroups();
-            QDomElement groups = createGroups();
-            if (not groups.isNull())
-            {
-                parseGroups(groups);
-            }
             break;
         }
     }
@@ -2706,18 +2753,13 @@ QDomElement VAbstractPattern::addGroupItem(quint32 toolId, quint32 objectId, qui
         item.setAttribute(AttrTool, toolId);
         item.setAttribute(AttrObject, objectId);
         group.appendChild(item);
+        indexGroupItem(groupId, toolId, objectId);
 
         modified = true;
         emit patternChanged(false);
 
         emit updateGroups();
 
-        QDomElement groups = createGroups();
-        if (not groups.isNull())
-        {
-            parseGroups(groups);
-        }
-
         return item;
     }
     else
@@ -2767,6 +2809,9 @@ QDomElement VAbstractPattern::removeGroupItem(quint32 toolId, quint32 objectId,
                     {
                         group.removeChild(itemNode);
 
+                        // update the drawing, in case the item was removed from an invisible group
+                        unindexGroupItem(groupId, toolId, objectId);
+
                         // to signalised that the pattern was changed and need to be saved
                         modified = true;
                         emit patternChanged(false);
@@ -2774,13 +2819,6 @@ QDomElement VAbstractPattern::removeGroupItem(quint32 toolId, quint32 objectId,
                         // to update the group table of the gui
                         emit updateGroups();
 
-                        // parse the groups to update the drawing, in case the item was removed from an invisible group
-                        QDomElement groups = createGroups();
-                        if (not groups.isNull())
-                        {
-                            parseGroups(groups);
-                        }
-
                         return item;
                     }
                 }
@@ -2817,6 +2855,68 @@ bool VAbstractPattern::isGroupEmpty(quint32 id)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief indexGroup adds a group element that was inserted in the active draft block to the membership index and
+ * updates visibility of its items.
+ * @param group group element.
+ */
+void VAbstractPattern::indexGroup(const QDomElement &group)
+{
+    const quint32 groupId = GetParametrUInt(group, AttrId, NULL_ID_STR);
+    VGroupIndex &index = getGroupIndex();
+    index.AddGroup(groupId);
+
+    const QPair<bool, QMap<quint32, quint32> > groupData = parseItemElement(group);
+    auto i = groupData.second.constBegin();
+    while (i != groupData.second.constEnd())
+    {
+        index.AddItem(groupId, i.value(), i.key());
+        ++i;
+    }
+
+    updateItemsVisibility(index.Items(groupId));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief unindexGroup removes a deleted group from the membership index and updates visibility of its items.
+ * @param groupId group id.
+ */
+void VAbstractPattern::unindexGroup(quint32 groupId)
+{
+    VGroupIndex &index = getGroupIndex();
+    const QVector<QPair<quint32, quint32> > items = index.Items(groupId);
+    index.RemoveGroup(groupId);
+    updateItemsVisibility(items);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief indexGroupItem records that the item was added to the group and updates the item visibility.
+ * @param groupId group id.
+ * @param toolId tool id.
+ * @param objectId object id.
+ */
+void VAbstractPattern::indexGroupItem(quint32 groupId, quint32 toolId, quint32 objectId)
+{
+    getGroupIndex().AddItem(groupId, toolId, objectId);
+    updateItemsVisibility(QVector<QPair<quint32, quint32> >{qMakePair(toolId, objectId)});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief unindexGroupItem records that the item was removed from the group and updates the item visibility.
+ * @param groupId group id.
+ * @param toolId tool id.
+ * @param objectId object id.
+ */
+void VAbstractPattern::unindexGroupItem(quint32 groupId, quint32 toolId, quint32 objectId)
+{
+    getGroupIndex().RemoveItem(groupId, toolId, objectId);
+    updateItemsVisibility(QVector<QPair<quint32, quint32> >{qMakePair(toolId, objectId)});
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VAbstractPattern::getGroupVisibility(quint32 id)
 {
@@ -2842,11 +2942,7 @@ void VAbstractPattern::setGroupVisibility(quint32 id, bool visible)
         modified = true;
         emit patternChanged(false);
 
-        QDomElement groups = createGroups();
-        if (not groups.isNull())
-        {
-            parseGroups(groups);
-        }
+        updateItemsVisibility(getGroupIndex().Items(id));
     }
     else
     {
@@ -2886,12 +2982,6 @@ void VAbstractPattern::setGroupLock(quint32 id, bool locked)
         modified = true;
         emit patternChanged(false);
         //qDebug("VAbstractPattern::setGroupLock - Group %u is locked.", id);
-
-        QDomElement groups = createGroups();
-        if (not groups.isNull())
-        {
-            parseGroups(groups);
-        }
     }
     else
     {
@@ -3033,67 +3123,110 @@ bool VAbstractPattern::groupNameExists(const QString &groupName)
 
 QString VAbstractPattern::useGroupColor(quint32 toolId, QString color)
 {
-    QMap<quint32,QString> groupsContainingItem = getGroupsContainingItem(toolId, 0, true);
-    QStringList list = QStringList(groupsContainingItem.values());
-    QString  groupName = list.value(0);
-
-    //qCDebug(vbstractPattern,"VAbstractPattern::useGroupColor - Group Name = %s",qUtf8Printable(groupName));
-    //qCDebug(vbstractPattern,"VAbstractPattern::useGroupColor - Tool ID = %d",toolId);
-    //qCDebug(vbstractPattern,"VAbstractPattern::useGroupColor - Tool Color = %s",qUtf8Printable(color));
-    quint32 objectId = toolId;
-    bool groupHasItem = hasGroupItem(getGroupByName(groupName), toolId, objectId);
-    //qCDebug(vbstractPattern,"VAbstractPattern::useGroupColor - Group has item = %d",groupHasItem);
-    if ((color == ColorByGroup) && groupHasItem)
+    if (color == ColorByGroup)
     {
-        QString groupColor = getGroupColor(getGroupIdByName(groupName));
-        //qCDebug(vbstractPattern,"VAbstractPattern::useGroupColor - Group Color = %s",qUtf8Printable(groupColor));
-        return groupColor;
-    }
-    else
-    {
-        return color;
+        const QVector<quint32> groups = getGroupIndex().GroupsOf(toolId, toolId);
+        if (not groups.isEmpty())
+        {
+            return getGroupColor(groups.first());
+        }
     }
+    return color;
 }
 
 QString VAbstractPattern::useGroupLineType(quint32 toolId, QString type)
 {
-    QMap<quint32,QString> groupsContainingItem = getGroupsContainingItem(toolId, 0, true);
-    QStringList list = QStringList(groupsContainingItem.values());
-    QString  groupName = list.value(0);
-
-    //qCDebug(vbstractPattern,"VAbstractPattern::useGroupLineType - Group Name = %s",qUtf8Printable(groupName));
-    //qCDebug(vbstractPattern,"VAbstractPattern::useGroupLineType - Tool ID = %d",toolId);
-    //qCDebug(vbstractPattern,"VAbstractPattern::useGroupLineType - Tool Color = %s",qUtf8Printable(type));
-    quint32 objectId = toolId;
-    bool groupHasItem = hasGroupItem(getGroupByName(groupName), toolId, objectId);
-    //qCDebug(vbstractPattern,"VAbstractPattern::useGroupLineType - Group has item = %d",groupHasItem);
-    if ((type == LineTypeByGroup) && groupHasItem)
+    if (type == LineTypeByGroup)
     {
-        QString groupLineType = getGroupLineType(getGroupIdByName(groupName));
-        //qCDebug(vbstractPattern,"VAbstractPattern::useGroupLineType - Group Linetpe = %s",qUtf8Printable(groupLineType));
-        return groupLineType;
+        const QVector<quint32> groups = getGroupIndex().GroupsOf(toolId, toolId);
+        if (not groups.isEmpty())
+        {
+            return getGroupLineType(groups.first());
+        }
     }
-    else
+    return type;
+}
+
+QString VAbstractPattern::useGroupLineWeight(quint32 toolId, QString weight)
+{
+    if (weight == LineWeightByGroup)
     {
-        return type;
+        const QVector<quint32> groups = getGroupIndex().GroupsOf(toolId, toolId);
+        if (not groups.isEmpty())
+        {
+            return getGroupLineWeight(groups.first());
+        }
     }
+    return weight;
 }
 
-QString VAbstractPattern::useGroupLineWeight(quint32 toolId, QString weight)
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getGroupIndex returns group membership of the active draft block.
+ *
+ * The index is rebuilt from the <groups> tag when the active draft block changes or after parseGroups() reported that
+ * the groups were edited outside of the index. Otherwise it is kept up to date by the group item methods.
+ */
+VGroupIndex &VAbstractPattern::getGroupIndex()
 {
-    QMap<quint32,QString> groupsContainingItem = getGroupsContainingItem(toolId, 0, true);
-    QStringList list = QStringList(groupsContainingItem.values());
-    QString  groupName = list.value(0);
+    QDomElement draftBlock;
+    getActiveDraftElement(draftBlock);
 
-    quint32 objectId = toolId;
-    bool groupHasItem = hasGroupItem(getGroupByName(groupName), toolId, objectId);
-    if ((weight == LineWeightByGroup) && groupHasItem)
+    if (not groupIndexValid || draftBlock != groupIndexBlock)
     {
-        QString groupLineWeight = getGroupLineWeight(getGroupIdByName(groupName));
-        return groupLineWeight;
+        groupIndex.Clear();
+
+        const QDomElement groups = draftBlock.firstChildElement(TagGroups);
+        QDomElement group = groups.firstChildElement(TagGroup);
+        while (not group.isNull())
+        {
+            const quint32 groupId = GetParametrUInt(group, AttrId, "0");
+            groupIndex.AddGroup(groupId);
+
+            QDomElement item = group.firstChildElement(TagGroupItem);
+            while (not item.isNull())
+            {
+                groupIndex.AddItem(groupId, GetParametrUInt(item, AttrTool, "0"), GetParametrUInt(item, AttrObject, "0"));
+                item = item.nextSiblingElement(TagGroupItem);
+            }
+            group = group.nextSiblingElement(TagGroup);
+        }
+
+        groupIndexBlock = draftBlock;
+        groupIndexValid = true;
     }
-    else
+
+    return groupIndex;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateItemsVisibility shows an item if at least one of its groups is visible or if it belongs to no group.
+ * @param items items as (tool id, object id) pairs.
+ */
+void VAbstractPattern::updateItemsVisibility(const QVector<QPair<quint32, quint32> > &items)
+{
+    const VGroupIndex &index = getGroupIndex();
+    for (auto &item : items)
     {
-        return weight;
+        VDataTool *tool = tools.value(item.first, nullptr);
+        if (tool == nullptr)
+        {
+            continue;
+        }
+
+        const QVector<quint32> groups = index.GroupsOf(item.first, item.second);
+        bool visible = groups.isEmpty();
+        for (auto groupId : groups)
+        {
+            const QDomElement group = elementById(groupId, TagGroup);
+            if (group.isElement() && getParameterBool(group, AttrVisible, trueStr))
+            {
+                visible = true;
+                break;
+            }
+        }
+
+        tool->GroupVisibility(item.second, visible);
     }
 }
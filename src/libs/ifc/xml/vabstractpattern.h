@@ -66,6 +66,7 @@
 #include <QVector>
 
 #include "vdomdocument.h"
+#include "vgroupindex.h"
 #include "vtoolrecord.h"
 #include "../vmisc/def.h"
 #include "../vwidgets/pen_toolbar.h"
@@ -160,8 +161,12 @@ class VAbstractPattern : public QObject, public VDomDocument
 
     void                           AddToolOnRemove(VDataTool *tool);
 
-    QVector<VToolRecord>          *getHistory();
+    const QVector<VToolRecord>    &getHistory() const;
     QVector<VToolRecord>           getBlockHistory() const;
+    QVector<VToolRecord>           getBlockHistory(const QString &blockName) const;
+    int                            historyRecordIndex(quint32 id) const;
+    bool                           addHistoryRecord(const VToolRecord &record, quint32 afterId = NULL_ID);
+    void                           clearHistory();
     QMap<quint32, Tool>            getGroupObjHistory() const;
 
     QString                        MPath() const;
@@ -247,6 +252,11 @@ class VAbstractPattern : public QObject, public VDomDocument
     QDomElement                    removeGroupItem(quint32 toolId, quint32 objectId, quint32 groupId);
     bool                           isGroupEmpty(quint32 id);
 
+    void                           indexGroup(const QDomElement &group);
+    void                           unindexGroup(quint32 groupId);
+    void                           indexGroupItem(quint32 groupId, quint32 toolId, quint32 objectId);
+    void                           unindexGroupItem(quint32 groupId, quint32 toolId, quint32 objectId);
+
     bool                           getGroupVisibility(quint32 id);
     void                           setGroupVisibility(quint32 id, bool visible);
 
@@ -483,9 +493,15 @@ public slots:
 
     QVector<VDataTool*> toolsOnRemove;
 
-    /** @brief history history records. */
+    /** @brief history history records in order they were added. */
     QVector<VToolRecord> history;
 
+    /** @brief blockHistory history records of each draft block in draft block order. */
+    QHash<QString, QVector<VToolRecord>> blockHistory;
+
+    /** @brief historyIndex position of each tool record in the history of its draft block. */
+    QHash<quint32, int> historyIndex;
+
     /** @brief patternPieces list of patern pieces names for combobox*/
     QStringList    patternPieces;
 
@@ -517,6 +533,14 @@ public slots:
 private:
     Q_DISABLE_COPY(VAbstractPattern)
 
+    /** @brief groupIndex group membership of the draft block groupIndexBlock. */
+    VGroupIndex            groupIndex;
+    QDomElement            groupIndexBlock;
+    bool                   groupIndexValid;
+
+    VGroupIndex           &getGroupIndex();
+    void                   updateItemsVisibility(const QVector<QPair<quint32, quint32> > &items);
+
     QStringList            ListIncrements() const;
     QVector<VFormulaField> ListPointExpressions() const;
     QVector<VFormulaField> ListArcExpressions() const;
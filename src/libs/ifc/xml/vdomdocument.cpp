@@ -84,10 +84,23 @@
 #include <QtDebug>
 #include <QXmlStreamWriter>
 
+#include <algorithm>
+
 namespace
 {
 //---------------------------------------------------------------------------------------------------------------------
-void SaveNodeCanonically(QXmlStreamWriter &stream, const QDomNode &domNode)
+/**
+ * @brief The CanonicalBuffers struct keeps temporary storage for attributes sorting between elements.
+ */
+struct CanonicalBuffers
+{
+    QVector<QDomNode> attributes;
+    QVector<QString>  names;
+    QVector<int>      order;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+void SaveNodeCanonically(QXmlStreamWriter &stream, const QDomNode &domNode, CanonicalBuffers &buffers)
 {
     if (stream.hasError())
     {
@@ -103,19 +116,30 @@ void SaveNodeCanonically(QXmlStreamWriter &stream, const QDomNode &domNode)
 
             if (domElement.hasAttributes())
             {
-                QMap<QString, QString> attributes;
+                // Attribute names are unique, sorting indexes by name gives the same order as QMap did.
                 const QDomNamedNodeMap attributeMap = domElement.attributes();
-                for (int i = 0; i < attributeMap.count(); ++i)
+                const int count = attributeMap.count();
+
+                buffers.attributes.resize(count);
+                buffers.names.resize(count);
+                buffers.order.resize(count);
+                for (int i = 0; i < count; ++i)
                 {
-                    const QDomNode attribute = attributeMap.item(i);
-                    attributes.insert(attribute.nodeName(), attribute.nodeValue());
+                    buffers.attributes[i] = attributeMap.item(i);
+                    buffers.names[i] = buffers.attributes.at(i).nodeName();
+                    buffers.order[i] = i;
                 }
 
-                QMap<QString, QString>::const_iterator i = attributes.constBegin();
-                while (i != attributes.constEnd())
+                const QVector<QString> &names = buffers.names;
+                std::sort(buffers.order.begin(), buffers.order.end(), [&names](int a, int b)
+                {
+                    return names.at(a) < names.at(b);
+                });
+
+                for (int i = 0; i < count; ++i)
                 {
-                    stream.writeAttribute(i.key(), i.value());
-                    ++i;
+                    const int index = buffers.order.at(i);
+                    stream.writeAttribute(names.at(index), buffers.attributes.at(index).nodeValue());
                 }
             }
 
@@ -124,7 +148,7 @@ void SaveNodeCanonically(QXmlStreamWriter &stream, const QDomNode &domNode)
                 QDomNode elementChild = domElement.firstChild();
                 while (not elementChild.isNull())
                 {
-                    SaveNodeCanonically(stream, elementChild);
+                    SaveNodeCanonically(stream, elementChild, buffers);
                     elementChild = elementChild.nextSibling();
                 }
             }
@@ -315,19 +339,22 @@ bool VDomDocument::find(const QDomElement &node, quint32 id)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-bool VDomDocument::SaveCanonicalXML(QIODevice *file, int indent, QString &error) const
+bool VDomDocument::SaveCanonicalXML(const QDomDocument &document, QIODevice *file, int indent, QString &error)
 {
     SCASSERT(file != nullptr)
 
-    QXmlStreamWriter stream(file);
+    // Collect whole document in memory and pass it to device in one call. Small writes through QSaveFile are slow.
+    QByteArray data;
+    QXmlStreamWriter stream(&data);
     stream.setAutoFormatting(true);
     stream.setAutoFormattingIndent(indent);
     stream.writeStartDocument();
 
-    QDomNode root = documentElement();
+    CanonicalBuffers buffers;
+    QDomNode root = document.documentElement();
     while (not root.isNull())
     {
-        SaveNodeCanonically(stream, root);
+        SaveNodeCanonically(stream, root, buffers);
         if (stream.hasError())
         {
             break;
@@ -337,7 +364,7 @@ bool VDomDocument::SaveCanonicalXML(QIODevice *file, int indent, QString &error)
 
     stream.writeEndDocument();
 
-    if (stream.hasError())
+    if (stream.hasError() || file->write(data) != data.size())
     {
         error = tr("Fail to write Canonical XML.");
         return false;
@@ -740,6 +767,23 @@ QString VDomDocument::UnitsHelpString()
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VDomDocument::SaveDocument(const QString &fileName, QString &error)
+{
+    return WriteDocument(*this, fileName, error);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WriteDocument write document to file in canonical form.
+ *
+ * Doesn't touch any VDomDocument state, so can be called from worker thread with a snapshot made by cloneNode(true)
+ * as long as nobody else uses this snapshot.
+ *
+ * @param document document to save.
+ * @param fileName path to file.
+ * @param error error message in case of failure.
+ * @return true if all is good.
+ */
+bool VDomDocument::WriteDocument(const QDomDocument &document, const QString &fileName, QString &error)
 {
     if (fileName.isEmpty())
     {
@@ -753,14 +797,14 @@ bool VDomDocument::SaveDocument(const QString &fileName, QString &error)
     {
         // See issue #666. QDomDocument produces random attribute order.
         const int indent = 4;
-        if (not SaveCanonicalXML(&file, indent, error))
+        if (not SaveCanonicalXML(document, &file, indent, error))
         {
             return false;
         }
         // Left these strings in case we will need them for testing purposes
         // QTextStream out(&file);
         // out.setCodec("UTF-8");
-        // save(out, indent);
+        // document.save(out, indent);
 
         success = file.commit();
     }
@@ -142,6 +142,8 @@ class VDomDocument : public QDomDocument
     static QString UnitsHelpString();
 
     virtual bool   SaveDocument(const QString &fileName, QString &error);
+    static bool    WriteDocument(const QDomDocument &document, const QString &fileName, QString &error);
+    static bool    SaveCanonicalXML(const QDomDocument &document, QIODevice *file, int indent, QString &error);
     QString        Major() const;
     QString        Minor() const;
     QString        Patch() const;
@@ -170,8 +172,6 @@ class VDomDocument : public QDomDocument
     QHash<quint32, QDomElement> map;
 
     bool           find(const QDomElement &node, quint32 id);
-
-    bool SaveCanonicalXML(QIODevice *file, int indent, QString &error) const;
 };
 
 //---------------------------------------------------------------------------------------------------------------------
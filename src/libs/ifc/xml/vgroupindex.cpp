@@ -0,0 +1,171 @@
+/***************************************************************************
+ **  @file   vgroupindex.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "vgroupindex.h"
+
+#include <algorithm>
+
+//---------------------------------------------------------------------------------------------------------------------
+VGroupIndex::VGroupIndex()
+    : m_items(),
+      m_groups()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::Clear()
+{
+    m_items.clear();
+    m_groups.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddGroup registers a group, so it is listed by Groups() even while empty.
+ */
+void VGroupIndex::AddGroup(quint32 groupId)
+{
+    if (not m_items.contains(groupId))
+    {
+        m_items.insert(groupId, QSet<quint64>());
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::RemoveGroup(quint32 groupId)
+{
+    const QSet<quint64> items = m_items.take(groupId);
+    for (auto item : items)
+    {
+        auto groups = m_groups.find(item);
+        if (groups != m_groups.end())
+        {
+            groups->remove(groupId);
+            if (groups->isEmpty())
+            {
+                m_groups.erase(groups);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddItem adds an item to a group. Adding an item twice has no effect.
+ */
+void VGroupIndex::AddItem(quint32 groupId, quint32 toolId, quint32 objectId)
+{
+    const quint64 item = ItemKey(toolId, objectId);
+    m_items[groupId].insert(item);
+    m_groups[item].insert(groupId);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::RemoveItem(quint32 groupId, quint32 toolId, quint32 objectId)
+{
+    const quint64 item = ItemKey(toolId, objectId);
+
+    auto items = m_items.find(groupId);
+    if (items != m_items.end())
+    {
+        items->remove(item);
+    }
+
+    auto groups = m_groups.find(item);
+    if (groups != m_groups.end())
+    {
+        groups->remove(groupId);
+        if (groups->isEmpty())
+        {
+            m_groups.erase(groups);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VGroupIndex::Contains(quint32 groupId, quint32 toolId, quint32 objectId) const
+{
+    const auto items = m_items.constFind(groupId);
+    return items != m_items.constEnd() && items->contains(ItemKey(toolId, objectId));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Groups returns ids of all known groups in ascending order.
+ */
+QVector<quint32> VGroupIndex::Groups() const
+{
+    QVector<quint32> groups;
+    groups.reserve(m_items.size());
+    for (auto i = m_items.constBegin(); i != m_items.constEnd(); ++i)
+    {
+        groups.append(i.key());
+    }
+    std::sort(groups.begin(), groups.end());
+    return groups;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GroupsOf returns ids of groups that contain the item, in ascending order.
+ */
+QVector<quint32> VGroupIndex::GroupsOf(quint32 toolId, quint32 objectId) const
+{
+    QVector<quint32> groups;
+    const auto found = m_groups.constFind(ItemKey(toolId, objectId));
+    if (found != m_groups.constEnd())
+    {
+        groups.reserve(found->size());
+        for (auto groupId : *found)
+        {
+            groups.append(groupId);
+        }
+        std::sort(groups.begin(), groups.end());
+    }
+    return groups;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Items returns items of the group as (tool id, object id) pairs.
+ */
+QVector<QPair<quint32, quint32> > VGroupIndex::Items(quint32 groupId) const
+{
+    QVector<QPair<quint32, quint32> > items;
+    const auto found = m_items.constFind(groupId);
+    if (found != m_items.constEnd())
+    {
+        items.reserve(found->size());
+        for (auto item : *found)
+        {
+            items.append(qMakePair(static_cast<quint32>(item >> 32), static_cast<quint32>(item & 0xFFFFFFFF)));
+        }
+    }
+    return items;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+quint64 VGroupIndex::ItemKey(quint32 toolId, quint32 objectId)
+{
+    return (static_cast<quint64>(toolId) << 32) | objectId;
+}
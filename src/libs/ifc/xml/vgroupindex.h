@@ -0,0 +1,70 @@
+/***************************************************************************
+ **  @file   vgroupindex.h
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#ifndef VGROUPINDEX_H
+#define VGROUPINDEX_H
+
+#include <QHash>
+#include <QPair>
+#include <QSet>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VGroupIndex class keeps group membership of a draft block in memory.
+ *
+ * Membership is stored in both directions (group -> items and item -> groups), so asking which groups hold an item
+ * or which items a group holds does not walk the <groups> DOM subtree. An item is identified by its tool id and
+ * object id, the same pair that is written to the group's item element.
+ */
+class VGroupIndex
+{
+public:
+    VGroupIndex();
+
+    void Clear();
+
+    void AddGroup(quint32 groupId);
+    void RemoveGroup(quint32 groupId);
+
+    void AddItem(quint32 groupId, quint32 toolId, quint32 objectId);
+    void RemoveItem(quint32 groupId, quint32 toolId, quint32 objectId);
+
+    bool Contains(quint32 groupId, quint32 toolId, quint32 objectId) const;
+
+    QVector<quint32>                   Groups() const;
+    QVector<quint32>                   GroupsOf(quint32 toolId, quint32 objectId) const;
+    QVector<QPair<quint32, quint32> >  Items(quint32 groupId) const;
+
+private:
+    /** @brief m_items group id -> items of the group. */
+    QHash<quint32, QSet<quint64> > m_items;
+
+    /** @brief m_groups item -> ids of groups that contain the item. */
+    QHash<quint64, QSet<quint32> > m_groups;
+
+    static quint64 ItemKey(quint32 toolId, quint32 objectId);
+};
+
+#endif // VGROUPINDEX_H
@@ -8,6 +8,7 @@ HEADERS += \
     $$PWD/vdomdocument.h \
     $$PWD/vpatternconverter.h \
     $$PWD/vtoolrecord.h \
+    $$PWD/vgroupindex.h \
     $$PWD/vabstractpattern.h \
     $$PWD//abstract_m_converter.h \
     $$PWD/vlabeltemplateconverter.h
@@ -19,6 +20,7 @@ SOURCES += \
     $$PWD/vdomdocument.cpp \
     $$PWD/vpatternconverter.cpp \
     $$PWD/vtoolrecord.cpp \
+    $$PWD/vgroupindex.cpp \
     $$PWD/vabstractpattern.cpp \
     $$PWD//abstract_m_converter.cpp \
     $$PWD/vlabeltemplateconverter.cpp
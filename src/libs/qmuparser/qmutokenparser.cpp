@@ -111,17 +111,24 @@ bool QmuTokenParser::IsSingle(const QString &formula)
         return false;// if don't know say no
     }
 
-    QScopedPointer<QmuTokenParser> cal(new QmuTokenParser());
+    if (IsPlainNumber(formula))
+    {
+        return true;// Most common case, no need to run parser
+    }
+
+    // Creating parser is expensive, so each thread keeps own instance.
+    static thread_local QmuTokenParser cal;
 
     // Parser doesn't know any variable on this stage. So, we just use variable factory that for each unknown
     // variable set value to 0.
-    cal->SetVarFactory(AddVariable, cal.data());
-    cal->SetSepForEval();//Reset separators options
+    cal.ClearVar();
+    cal.SetVarFactory(AddVariable, &cal);
+    cal.SetSepForEval();//Reset separators options
 
     try
     {
-        cal->SetExpr(formula);
-        cal->Eval();// We don't need save result, only parse formula
+        cal.SetExpr(formula);
+        cal.Eval();// We don't need save result, only parse formula
     }
     catch (const qmu::QmuParserError &error)
     {
@@ -129,14 +136,13 @@ bool QmuTokenParser::IsSingle(const QString &formula)
         return false;// something wrong with formula, say no
     }
 
-    QMap<int, QString> tokens = cal->GetTokens();// Tokens (variables, measurements)
-    const QMap<int, QString> numbers = cal->GetNumbers();// All numbers in expression
-    delete cal.take();
+    QMap<int, QString> tokens = cal.GetTokens();// Tokens (variables, measurements)
+    const int numbers = cal.GetNumbers().size();// All numbers in expression
 
     // Remove "-" from tokens list if exist. If don't do that unary minus operation will broken.
     RemoveAll(tokens, QStringLiteral("-"));
 
-    if (tokens.isEmpty() && numbers.size() == 1)
+    if (tokens.isEmpty() && numbers == 1)
     {
         return true;
     }
@@ -146,4 +152,50 @@ bool QmuTokenParser::IsSingle(const QString &formula)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsPlainNumber lexical check for a number without thousand separators and exponent.
+ *
+ * Accepts optional minus, digits and optional decimal part with dot. Everything else should be checked by parser, so
+ * false here doesn't mean that formula is not a single number.
+ *
+ * @param formula expression in internal (C) locale
+ * @return true if formula is a plain number
+ */
+bool QmuTokenParser::IsPlainNumber(const QString &formula)
+{
+    int i = 0;
+    if (formula.at(0) == QLatin1Char('-'))
+    {
+        ++i;
+    }
+
+    int integerDigits = 0;
+    while (i < formula.size() && formula.at(i) >= QLatin1Char('0') && formula.at(i) <= QLatin1Char('9'))
+    {
+        ++integerDigits;
+        ++i;
+    }
+
+    if (i == formula.size())
+    {
+        return integerDigits > 0;
+    }
+
+    if (formula.at(i) != QLatin1Char('.'))
+    {
+        return false;
+    }
+    ++i;
+
+    int fractionDigits = 0;
+    while (i < formula.size() && formula.at(i) >= QLatin1Char('0') && formula.at(i) <= QLatin1Char('9'))
+    {
+        ++fractionDigits;
+        ++i;
+    }
+
+    return i == formula.size() && fractionDigits > 0;
+}
+
 }// namespace qmu
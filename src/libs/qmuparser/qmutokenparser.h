@@ -42,6 +42,8 @@ class QmuTokenParser : public QmuFormulaBase
 private:
     Q_DISABLE_COPY(QmuTokenParser)
     QmuTokenParser();
+
+    static bool IsPlainNumber(const QString &formula);
 };
 
 } // namespace qmu
@@ -166,10 +166,10 @@ void VDxfEngine::drawPath(const QPainterPath &path)
 
             poly->flags |= 0x80; // plinegen
 
-            for (int i=0; i < polygon.count(); ++i)
+            const QVector<QPointF> dxfPolygon = FromPixel(polygon, varInsunits);
+            for (int i=0; i < dxfPolygon.count(); ++i)
             {
-                poly->addVertex(DRW_Vertex2D(FromPixel(polygon.at(i).x(), varInsunits),
-                                             FromPixel(getSize().height() - polygon.at(i).y(), varInsunits), 0));
+                poly->addVertex(DRW_Vertex2D(dxfPolygon.at(i).x(), dxfPolygon.at(i).y(), 0));
             }
 
             input->AddEntity(poly);
@@ -188,10 +188,10 @@ void VDxfEngine::drawPath(const QPainterPath &path)
 
             poly->flags |= 0x80; // plinegen
 
-            for (int i=0; i < polygon.count(); ++i)
+            const QVector<QPointF> dxfPolygon = FromPixel(polygon, varInsunits);
+            for (int i=0; i < dxfPolygon.count(); ++i)
             {
-                poly->addVertex(DRW_Vertex(FromPixel(polygon.at(i).x(), varInsunits),
-                                           FromPixel(getSize().height() - polygon.at(i).y(), varInsunits), 0, 0));
+                poly->addVertex(DRW_Vertex(dxfPolygon.at(i).x(), dxfPolygon.at(i).y(), 0, 0));
             }
 
             input->AddEntity(poly);
@@ -252,11 +252,10 @@ void VDxfEngine::drawPolygon(const QPointF *points, int pointCount, PolygonDrawM
 
         poly->flags |= 0x80; // plinegen
 
-        for (int i = 0; i < pointCount; ++i)
+        const QVector<QPointF> dxfPolygon = FromPixel(MapPolygon(points, pointCount), varInsunits);
+        for (int i = 0; i < dxfPolygon.size(); ++i)
         {
-            const QPointF p = transform.map(points[i]);
-            poly->addVertex(DRW_Vertex2D(FromPixel(p.x(), varInsunits),
-                                         FromPixel(getSize().height() - p.y(), varInsunits), 0));
+            poly->addVertex(DRW_Vertex2D(dxfPolygon.at(i).x(), dxfPolygon.at(i).y(), 0));
         }
 
         input->AddEntity(poly);
@@ -276,11 +275,10 @@ void VDxfEngine::drawPolygon(const QPointF *points, int pointCount, PolygonDrawM
 
         poly->flags |= 0x80; // plinegen
 
-        for (int i = 0; i < pointCount; ++i)
+        const QVector<QPointF> dxfPolygon = FromPixel(MapPolygon(points, pointCount), varInsunits);
+        for (int i = 0; i < dxfPolygon.size(); ++i)
         {
-            const QPointF p = transform.map(points[i]);
-            poly->addVertex(DRW_Vertex(FromPixel(p.x(), varInsunits),
-                                       FromPixel(getSize().height() - p.y(), varInsunits), 0, 0));
+            poly->addVertex(DRW_Vertex(dxfPolygon.at(i).x(), dxfPolygon.at(i).y(), 0, 0));
         }
 
         input->AddEntity(poly);
@@ -603,6 +601,27 @@ double VDxfEngine::ToPixel(double val, const VarInsunits &unit) const
 
 QT_WARNING_POP
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FromPixel convert polygon to DXF coordinates: units of the file and y axis pointing up.
+ */
+QVector<QPointF> VDxfEngine::FromPixel(const QVector<QPointF> &polygon, const VarInsunits &unit) const
+{
+    const double factor = FromPixel(1.0, unit);
+    return MapPoints(polygon, factor, -factor, 0, FromPixel(getSize().height(), unit));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> VDxfEngine::MapPolygon(const QPointF *points, int pointCount) const
+{
+    QVector<QPointF> polygon(pointCount);
+    for (int i = 0; i < pointCount; ++i)
+    {
+        polygon[i] = transform.map(points[i]);
+    }
+    return polygon;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VDxfEngine::ExportToAAMA(const QVector<VLayoutPiece> &details)
 {
@@ -842,10 +861,10 @@ P *VDxfEngine::CreateAAMAPolygon(const QVector<QPointF> &polygon, const QString
         }
     }
 
-    for (int i=0; i < polygon.count(); ++i)
+    const QVector<QPointF> dxfPolygon = FromPixel(polygon, varInsunits);
+    for (int i=0; i < dxfPolygon.count(); ++i)
     {
-        poly->addVertex(V(FromPixel(polygon.at(i).x(), varInsunits),
-                          FromPixel(getSize().height() - polygon.at(i).y(), varInsunits)));
+        poly->addVertex(V(dxfPolygon.at(i).x(), dxfPolygon.at(i).y()));
     }
 
     return poly;
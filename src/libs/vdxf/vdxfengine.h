@@ -107,6 +107,8 @@ class VDxfEngine : public QPaintEngine
 
     Q_REQUIRED_RESULT double FromPixel(double pix, const VarInsunits &unit) const;
     Q_REQUIRED_RESULT double ToPixel(double val, const VarInsunits &unit) const;
+    Q_REQUIRED_RESULT QVector<QPointF> FromPixel(const QVector<QPointF> &polygon, const VarInsunits &unit) const;
+    Q_REQUIRED_RESULT QVector<QPointF> MapPolygon(const QPointF *points, int pointCount) const;
 
     bool ExportToAAMA(const QVector<VLayoutPiece> &details);
     void ExportAAMAOutline(dx_ifaceBlock *detailBlock, const VLayoutPiece &detail);
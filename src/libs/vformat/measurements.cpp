@@ -287,76 +287,147 @@ void MeasurementDoc::readMeasurements() const
     // Container for values in measurement file's unit
     QScopedPointer<VContainer> tempData(new VContainer(data->GetTrVars(), data->GetPatternUnit()));
 
+    const qreal unitFactor = UnitFactor(measurementUnits(), *data->GetPatternUnit());
     const QDomNodeList list = elementsByTagName(TagMeasurement);
     for (int i=0; i < list.size(); ++i)
     {
-        const QDomElement dom = list.at(i).toElement();
+        readMeasurement(list.at(i).toElement(), i, tempData.data(), unitFactor);
+    }
+}
 
-        const QString name = GetParametrString(dom, AttrName);
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateMeasurement re-read one measurement and re-evaluate only measurements that depend on it.
+ *
+ * Much cheaper than readMeasurements() after editing a single measurement. The dependency check is lexical: a formula
+ * that mentions the name of an updated measurement is evaluated again. Measurements must already be read.
+ *
+ * @param name internal name of the changed measurement.
+ * @return names of all measurements which were updated.
+ */
+QStringList MeasurementDoc::updateMeasurement(const QString &name) const
+{
+    if (type == MeasurementsType::Individual && measurementUnits() != *data->GetPatternUnit())
+    {// Values in the container were converted, we can't use them for evaluation.
+        readMeasurements();
+        return ListAll();
+    }
 
-        QString description;
-        try
-        {
-            description = GetParametrString(dom, AttrDescription);
-        }
-        catch (VExceptionEmptyParameter &error)
+    // Container for values in measurement file's unit. Units are the same, so unchanged values can be shared.
+    QScopedPointer<VContainer> tempData(new VContainer(data->GetTrVars(), data->GetPatternUnit()));
+    const QMap<QString, QSharedPointer<MeasurementVariable> > current = data->DataMeasurements();
+
+    QStringList updated;
+    const qreal unitFactor = UnitFactor(measurementUnits(), *data->GetPatternUnit());
+    const QDomNodeList list = elementsByTagName(TagMeasurement);
+    for (int i=0; i < list.size(); ++i)
+    {
+        const QDomElement dom = list.at(i).toElement();
+        const QString mName = GetParametrString(dom, AttrName);
+
+        bool changed = (mName == name || not current.contains(mName));
+        if (not changed && not updated.isEmpty() && type == MeasurementsType::Individual)
         {
-            Q_UNUSED(error)
+            const QString formula = GetParametrString(dom, AttrValue, "0");
+            for (int j=0; j < updated.size(); ++j)
+            {
+                if (formula.contains(updated.at(j)))
+                {
+                    changed = true;
+                    break;
+                }
+            }
         }
 
-        QString fullName;
-        try
+        if (changed)
         {
-            fullName = GetParametrString(dom, AttrFullName);
+            readMeasurement(dom, i, tempData.data(), unitFactor);
+            updated.append(mName);
         }
-        catch (VExceptionEmptyParameter &error)
+        else if (type == MeasurementsType::Individual)
         {
-            Q_UNUSED(error)
+            tempData->AddVariable(mName, current.value(mName));
         }
+    }
 
-        QSharedPointer<MeasurementVariable> meash;
-        QSharedPointer<MeasurementVariable> tempMeash;
-        if (type == MeasurementsType::Multisize)
-        {
-            qreal base = GetParametrDouble(dom, AttrBase, "0");
-            qreal ksize = GetParametrDouble(dom, AttrSizeIncrease, "0");
-            qreal kheight = GetParametrDouble(dom, AttrHeightIncrease, "0");
-
-            tempMeash = QSharedPointer<MeasurementVariable>(new MeasurementVariable(static_cast<quint32>(i), name, BaseSize(),
-                                                                      BaseHeight(), base, ksize, kheight));
-            tempMeash->setSize(m_currentSize);
-            tempMeash->setHeight(m_currentHeight);
-            tempMeash->SetUnit(data->GetPatternUnit());
-
-            base = UnitConvertor(base, measurementUnits(), *data->GetPatternUnit());
-            ksize = UnitConvertor(ksize, measurementUnits(), *data->GetPatternUnit());
-            kheight = UnitConvertor(kheight, measurementUnits(), *data->GetPatternUnit());
-
-            const qreal baseSize = UnitConvertor(BaseSize(), measurementUnits(), *data->GetPatternUnit());
-            const qreal baseHeight = UnitConvertor(BaseHeight(), measurementUnits(), *data->GetPatternUnit());
-
-            meash = QSharedPointer<MeasurementVariable>(new MeasurementVariable(static_cast<quint32>(i), name, baseSize, baseHeight,
-                                                                  base, ksize, kheight, fullName, description));
-            meash->setSize(m_currentSize);
-            meash->setHeight(m_currentHeight);
-            meash->SetUnit(data->GetPatternUnit());
-        }
-        else
-        {
-            const QString formula = GetParametrString(dom, AttrValue, "0");
-            bool ok = false;
-            qreal value = EvalFormula(tempData.data(), formula, &ok);
+    return updated;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief readMeasurement read measurement and add it to both containers.
+ * @param dom measurement tag.
+ * @param index position of the measurement in the file.
+ * @param tempData container for values in measurement file's unit.
+ * @param unitFactor factor that converts values from measurement file's unit to pattern unit.
+ */
+void MeasurementDoc::readMeasurement(const QDomElement &dom, int index, VContainer *tempData,
+                                     qreal unitFactor) const
+{
+    const QString name = GetParametrString(dom, AttrName);
 
-            tempMeash = QSharedPointer<MeasurementVariable>(new MeasurementVariable(tempData.data(), static_cast<quint32>(i), name,
-                                                                      value, formula, ok));
+    QString description;
+    try
+    {
+        description = GetParametrString(dom, AttrDescription);
+    }
+    catch (VExceptionEmptyParameter &error)
+    {
+        Q_UNUSED(error)
+    }
 
-            value = UnitConvertor(value, measurementUnits(), *data->GetPatternUnit());
-            meash = QSharedPointer<MeasurementVariable>(new MeasurementVariable(data, static_cast<quint32>(i), name, value, formula,
-                                                                  ok, fullName, description));
-        }
-        tempData->AddVariable(name, tempMeash);
-        data->AddVariable(name, meash);
+    QString fullName;
+    try
+    {
+        fullName = GetParametrString(dom, AttrFullName);
+    }
+    catch (VExceptionEmptyParameter &error)
+    {
+        Q_UNUSED(error)
+    }
+
+    QSharedPointer<MeasurementVariable> meash;
+    QSharedPointer<MeasurementVariable> tempMeash;
+    if (type == MeasurementsType::Multisize)
+    {
+        qreal base = GetParametrDouble(dom, AttrBase, "0");
+        qreal ksize = GetParametrDouble(dom, AttrSizeIncrease, "0");
+        qreal kheight = GetParametrDouble(dom, AttrHeightIncrease, "0");
+
+        tempMeash = QSharedPointer<MeasurementVariable>(new MeasurementVariable(static_cast<quint32>(index), name, BaseSize(),
+                                                                  BaseHeight(), base, ksize, kheight));
+        tempMeash->setSize(m_currentSize);
+        tempMeash->setHeight(m_currentHeight);
+        tempMeash->SetUnit(data->GetPatternUnit());
+
+        base *= unitFactor;
+        ksize *= unitFactor;
+        kheight *= unitFactor;
+
+        const qreal baseSize = BaseSize() * unitFactor;
+        const qreal baseHeight = BaseHeight() * unitFactor;
+
+        meash = QSharedPointer<MeasurementVariable>(new MeasurementVariable(static_cast<quint32>(index), name, baseSize, baseHeight,
+                                                              base, ksize, kheight, fullName, description));
+        meash->setSize(m_currentSize);
+        meash->setHeight(m_currentHeight);
+        meash->SetUnit(data->GetPatternUnit());
+    }
+    else
+    {
+        const QString formula = GetParametrString(dom, AttrValue, "0");
+        bool ok = false;
+        qreal value = EvalFormula(tempData, formula, &ok);
+
+        tempMeash = QSharedPointer<MeasurementVariable>(new MeasurementVariable(tempData, static_cast<quint32>(index), name,
+                                                                  value, formula, ok));
+
+        value *= unitFactor;
+        meash = QSharedPointer<MeasurementVariable>(new MeasurementVariable(data, static_cast<quint32>(index), name, value, formula,
+                                                              ok, fullName, description));
     }
+    tempData->AddVariable(name, tempMeash);
+    data->AddVariable(name, meash);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -90,6 +90,7 @@ class MeasurementDoc : public VDomDocument
     void             MoveBottom(const QString &name);
 
     void             readMeasurements() const;
+    QStringList      updateMeasurement(const QString &name) const;
     void             ClearForExport();
 
     MeasurementsType Type() const;
@@ -188,6 +189,8 @@ class MeasurementDoc : public VDomDocument
     QDomElement          FindM(const QString &name) const;
     MeasurementsType     ReadType() const;
 
+    void                 readMeasurement(const QDomElement &dom, int index, VContainer *tempData,
+                                         qreal unitFactor) const;
     qreal                EvalFormula(VContainer *data, const QString &formula, bool *ok) const;
 
     QString              ClearPMCode(const QString &code) const;
@@ -58,6 +58,7 @@
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
+#include "../vmisc/vtrace.h"
 #include "../vgeometry/vpointf.h"
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -534,6 +535,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
 QVector<QPointF> VAbstractCubicBezier::GetCubicBezierPoints(const QPointF &p1, const QPointF &p2, const QPointF &p3,
                                                             const QPointF &p4)
 {
+    V_TRACE_SCOPE("VAbstractCubicBezier::GetCubicBezierPoints", "geometry");
     QVector<QPointF> pvector;
     QVector<qreal> x;
     QVector<qreal> y;
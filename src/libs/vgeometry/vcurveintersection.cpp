@@ -0,0 +1,258 @@
+/***************************************************************************
+ **  @file   vcurveintersection.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "vcurveintersection.h"
+
+#include <QPair>
+#include <algorithm>
+
+namespace
+{
+// Number of segments in a leaf of the hierarchy
+const int leafSegments = 4;
+
+// Boxes are inflated a little to never prune a pair that QLineF::intersects() reports as touching
+const qreal boxMargin = 1e-6;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VCurveIntersection::Node::Overlaps(const Node &node) const
+{
+    return minX <= node.maxX && node.minX <= maxX && minY <= node.maxY && node.minY <= maxY;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VCurveIntersection::VCurveIntersection(const QVector<QPointF> &points)
+    : m_points(points),
+      m_nodes()
+{
+    const int segments = m_points.size() - 1;
+    if (segments > 0)
+    {
+        m_nodes.reserve(2 * (segments / leafSegments + 1));
+        Build(0, segments);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntersectLine returns bounded intersections of the line with the curve.
+ *
+ * Gives the same result as VAbstractCurve::CurveIntersectLine().
+ */
+QVector<QPointF> VCurveIntersection::IntersectLine(const QLineF &line) const
+{
+    QVector<QPointF> intersections;
+    if (m_nodes.isEmpty())
+    {
+        return intersections;
+    }
+
+    Node query = Node();
+    query.minX = qMin(line.x1(), line.x2()) - boxMargin;
+    query.minY = qMin(line.y1(), line.y2()) - boxMargin;
+    query.maxX = qMax(line.x1(), line.x2()) + boxMargin;
+    query.maxY = qMax(line.y1(), line.y2()) + boxMargin;
+
+    QVector<int> segments;
+    QVector<int> stack;
+    stack.append(0);
+    while (not stack.isEmpty())
+    {
+        const Node &node = m_nodes.at(stack.takeLast());
+        if (not node.Overlaps(query) || IsOnOneSide(node, line))
+        {
+            continue;
+        }
+
+        if (node.IsLeaf())
+        {
+            for (int i = node.begin; i < node.end; ++i)
+            {
+                segments.append(i);
+            }
+        }
+        else
+        {
+            stack.append(node.right);
+            stack.append(node.left);
+        }
+    }
+
+    std::sort(segments.begin(), segments.end());
+
+    for (int i : qAsConst(segments))
+    {
+        QPointF crossPoint;
+        if (line.intersects(QLineF(m_points.at(i), m_points.at(i+1)), &crossPoint) == QLineF::BoundedIntersection)
+        {
+            intersections.append(crossPoint);
+        }
+    }
+    return intersections;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntersectCurve returns bounded intersections of segments of this curve with segments of another curve.
+ *
+ * Order of points is the same as for the sweep that intersects each segment of this curve with the whole second curve.
+ */
+QVector<QPointF> VCurveIntersection::IntersectCurve(const VCurveIntersection &curve) const
+{
+    QVector<QPointF> intersections;
+    if (m_nodes.isEmpty() || curve.m_nodes.isEmpty())
+    {
+        return intersections;
+    }
+
+    QVector<QPair<int, int>> candidates;
+    QVector<QPair<int, int>> stack;
+    stack.append(qMakePair(0, 0));
+    while (not stack.isEmpty())
+    {
+        const QPair<int, int> pair = stack.takeLast();
+        const Node &node1 = m_nodes.at(pair.first);
+        const Node &node2 = curve.m_nodes.at(pair.second);
+
+        if (not node1.Overlaps(node2))
+        {
+            continue;
+        }
+
+        if (node1.IsLeaf() && node2.IsLeaf())
+        {
+            for (int i = node1.begin; i < node1.end; ++i)
+            {
+                for (int j = node2.begin; j < node2.end; ++j)
+                {
+                    candidates.append(qMakePair(i, j));
+                }
+            }
+        }
+        else if (not node1.IsLeaf() && (node2.IsLeaf() || node1.end - node1.begin >= node2.end - node2.begin))
+        {
+            stack.append(qMakePair(node1.right, pair.second));
+            stack.append(qMakePair(node1.left, pair.second));
+        }
+        else
+        {
+            stack.append(qMakePair(pair.first, node2.right));
+            stack.append(qMakePair(pair.first, node2.left));
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const QPair<int, int> &candidate : qAsConst(candidates))
+    {
+        const QLineF line1(m_points.at(candidate.first), m_points.at(candidate.first+1));
+        const QLineF line2(curve.m_points.at(candidate.second), curve.m_points.at(candidate.second+1));
+
+        QPointF crossPoint;
+        if (line1.intersects(line2, &crossPoint) == QLineF::BoundedIntersection)
+        {
+            intersections.append(crossPoint);
+        }
+    }
+    return intersections;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> VCurveIntersection::CurvesIntersections(const QVector<QPointF> &curve1,
+                                                         const QVector<QPointF> &curve2)
+{
+    return VCurveIntersection(curve1).IntersectCurve(VCurveIntersection(curve2));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VCurveIntersection::Build(int begin, int end)
+{
+    const int index = m_nodes.size();
+    m_nodes.append(Node());
+
+    Node node;
+    node.begin = begin;
+    node.end = end;
+
+    if (end - begin <= leafSegments)
+    {
+        node.left = -1;
+        node.right = -1;
+        node.minX = node.maxX = m_points.at(begin).x();
+        node.minY = node.maxY = m_points.at(begin).y();
+        for (int i = begin + 1; i <= end; ++i)
+        {
+            const QPointF &p = m_points.at(i);
+            node.minX = qMin(node.minX, p.x());
+            node.minY = qMin(node.minY, p.y());
+            node.maxX = qMax(node.maxX, p.x());
+            node.maxY = qMax(node.maxY, p.y());
+        }
+        node.minX -= boxMargin;
+        node.minY -= boxMargin;
+        node.maxX += boxMargin;
+        node.maxY += boxMargin;
+    }
+    else
+    {
+        const int middle = begin + (end - begin) / 2;
+        node.left = Build(begin, middle);
+        node.right = Build(middle, end);
+
+        const Node &left = m_nodes.at(node.left);
+        const Node &right = m_nodes.at(node.right);
+        node.minX = qMin(left.minX, right.minX);
+        node.minY = qMin(left.minY, right.minY);
+        node.maxX = qMax(left.maxX, right.maxX);
+        node.maxY = qMax(left.maxY, right.maxY);
+    }
+
+    m_nodes[index] = node;
+    return index;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsOnOneSide checks if the whole box lies on one side of the infinite line through the segment.
+ */
+bool VCurveIntersection::IsOnOneSide(const Node &node, const QLineF &line) const
+{
+    const qreal dx = line.dx();
+    const qreal dy = line.dy();
+    const qreal tolerance = boxMargin * qMax(qAbs(dx) + qAbs(dy), 1.0);
+
+    auto Side = [&line, dx, dy](qreal x, qreal y)
+    {
+        return dx * (y - line.y1()) - dy * (x - line.x1());
+    };
+
+    const qreal s1 = Side(node.minX, node.minY);
+    const qreal s2 = Side(node.maxX, node.minY);
+    const qreal s3 = Side(node.maxX, node.maxY);
+    const qreal s4 = Side(node.minX, node.maxY);
+
+    return (s1 > tolerance && s2 > tolerance && s3 > tolerance && s4 > tolerance)
+            || (s1 < -tolerance && s2 < -tolerance && s3 < -tolerance && s4 < -tolerance);
+}
@@ -0,0 +1,76 @@
+/***************************************************************************
+ **  @file   vcurveintersection.h
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#ifndef VCURVEINTERSECTION_H
+#define VCURVEINTERSECTION_H
+
+#include <QLineF>
+#include <QPointF>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VCurveIntersection class finds intersections of tessellated curves.
+ *
+ * Segments of a polyline are grouped into a bounding box hierarchy. Neighbour segments of a curve lie close to each
+ * other, so splitting the index range in halves gives tight boxes without sorting. Curve to curve and curve to line
+ * queries test only segments whose boxes overlap, which turns the usual O(n·m) sweep into near linear time.
+ *
+ * Results are the same as the brute force sweep: candidate segments are tested with QLineF::intersects() and only
+ * bounded intersections are accepted, in the order of segment indexes.
+ */
+class VCurveIntersection
+{
+public:
+    explicit VCurveIntersection(const QVector<QPointF> &points);
+
+    QVector<QPointF> IntersectLine(const QLineF &line) const;
+    QVector<QPointF> IntersectCurve(const VCurveIntersection &curve) const;
+
+    static QVector<QPointF> CurvesIntersections(const QVector<QPointF> &curve1, const QVector<QPointF> &curve2);
+
+private:
+    struct Node
+    {
+        qreal minX;
+        qreal minY;
+        qreal maxX;
+        qreal maxY;
+        int   begin; // first segment
+        int   end;   // past the last segment
+        int   left;
+        int   right;
+
+        bool IsLeaf() const { return left < 0; }
+        bool Overlaps(const Node &node) const;
+    };
+
+    QVector<QPointF> m_points;
+    QVector<Node>    m_nodes;
+
+    int  Build(int begin, int end);
+    bool IsOnOneSide(const Node &node, const QLineF &line) const;
+};
+
+#endif // VCURVEINTERSECTION_H
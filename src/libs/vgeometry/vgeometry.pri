@@ -4,6 +4,7 @@
 SOURCES += \
         $$PWD/vgobject.cpp \
         $$PWD/vabstractcurve.cpp \
+        $$PWD/vcurveintersection.cpp \
         $$PWD/varc.cpp \
         $$PWD/vpointf.cpp \
         $$PWD/vspline.cpp \
@@ -24,6 +25,7 @@ HEADERS += \
         $$PWD/vgobject.h \
         $$PWD/vgobject_p.h \
         $$PWD/vabstractcurve.h \
+        $$PWD/vcurveintersection.h \
         $$PWD/varc.h \
         $$PWD/varc_p.h \
         $$PWD/vpointf.h \
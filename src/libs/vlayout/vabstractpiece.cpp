@@ -52,6 +52,7 @@
 #include "vabstractpiece.h"
 #include "vabstractpiece_p.h"
 #include "../vmisc/vabstractapplication.h"
+#include "../vmisc/vtrace.h"
 #include "../vgeometry/vpointf.h"
 
 #include <QLineF>
@@ -206,6 +207,7 @@ void VAbstractPiece::SetSAWidth(qreal value)
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VAbstractPiece::Equidistant(const QVector<VSAPoint> &points, qreal width)
 {
+    V_TRACE_SCOPE("VAbstractPiece::Equidistant", "geometry");
     if (width < 0)
     {
         qDebug() << "Width < 0.";
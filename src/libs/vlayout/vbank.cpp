@@ -56,6 +56,7 @@
 
 #include "../vmisc/diagnostic.h"
 #include "../vmisc/logging.h"
+#include "../vmisc/vtrace.h"
 #include "vlayoutpiece.h"
 
 QT_WARNING_PUSH
@@ -200,6 +201,7 @@ void VBank::NotArranged(int i)
 //---------------------------------------------------------------------------------------------------------------------
 bool VBank::Prepare()
 {
+    V_TRACE_SCOPE("VBank::Prepare", "layout");
     if (layoutWidth <= 0)
     {
         qCDebug(lBank, "Preparing data for layout error: Layout paper sheet <= 0");
@@ -62,6 +62,7 @@
 #include "vcontour_p.h"
 #include "vlayoutpiece.h"
 #include "../vmisc/vmath.h"
+#include "../vmisc/vtrace.h"
 
 #ifdef Q_COMPILER_RVALUE_REFS
 VContour &VContour::operator=(VContour &&contour) Q_DECL_NOTHROW { Swap(contour); return *this; }
@@ -157,6 +158,7 @@ QSizeF VContour::GetSize() const
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VContour::UniteWithContour(const VLayoutPiece &detail, int globalI, int detJ, BestFrom type) const
 {
+    V_TRACE_SCOPE("VContour::UniteWithContour", "layout");
     QVector<QPointF> newContour;
     if (d->globalContour.isEmpty()) //-V807
     {
@@ -14,6 +14,7 @@ HEADERS += \
     $$PWD/vposition.h \
     $$PWD/vtextmanager.h \
     $$PWD/vposter.h \
+    $$PWD/vscenedisplaylist.h \
     $$PWD/vgraphicsfillitem.h \
     $$PWD/vabstractpiece.h \
     $$PWD/vabstractpiece_p.h \
@@ -31,6 +32,7 @@ SOURCES += \
     $$PWD/vposition.cpp \
     $$PWD/vtextmanager.cpp \
     $$PWD/vposter.cpp \
+    $$PWD/vscenedisplaylist.cpp \
     $$PWD/vgraphicsfillitem.cpp \
     $$PWD/vabstractpiece.cpp \
     $$PWD/vlayoutpiece.cpp \
@@ -57,6 +57,7 @@
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
+#include "../vmisc/vtrace.h"
 #include "vlayoutpiece.h"
 #include "vlayoutpaper.h"
 
@@ -122,6 +123,7 @@ int VLayoutGenerator::PieceCount()
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutGenerator::Generate()
 {
+    V_TRACE_SCOPE("VLayoutGenerator::Generate", "layout");
     stopGeneration.store(false);
     papers.clear();
     state = LayoutErrors::NoError;
@@ -72,6 +72,7 @@
 #include "vlayoutpiece.h"
 #include "vlayoutpaper_p.h"
 #include "vposition.h"
+#include "../vmisc/vtrace.h"
 
 #ifdef Q_COMPILER_RVALUE_REFS
 VLayoutPaper &VLayoutPaper::operator=(VLayoutPaper &&paper) Q_DECL_NOTHROW { Swap(paper); return *this; }
@@ -216,6 +217,7 @@ void VLayoutPaper::SetPaperIndex(quint32 index)
 //---------------------------------------------------------------------------------------------------------------------
 bool VLayoutPaper::arrangePiece(const VLayoutPiece &piece, std::atomic_bool &stop)
 {
+    V_TRACE_SCOPE("VLayoutPaper::arrangePiece", "layout");
     // First need set size of paper
     if (d->globalContour.GetHeight() <= 0 || d->globalContour.GetWidth() <= 0)
     {
@@ -74,6 +74,7 @@
 #include "../vmisc/vmath.h"
 #include "../vmisc/vabstractapplication.h"
 #include "../vmisc/vcommonsettings.h"
+#include "../vmisc/vtrace.h"
 #include "../vpatterndb/calculator.h"
 #include "../vgeometry/vpointf.h"
 #include "vlayoutdef.h"
@@ -416,6 +417,7 @@ VLayoutPiece::~VLayoutPiece()
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutPiece VLayoutPiece::Create(const VPiece &piece, const VContainer *pattern)
 {
+    V_TRACE_SCOPE("VLayoutPiece::Create", "layout");
     VLayoutPiece layoutPiece;
 
     layoutPiece.SetMx(piece.GetMx());
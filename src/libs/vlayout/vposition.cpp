@@ -72,6 +72,7 @@
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
+#include "../vmisc/vtrace.h"
 
 //---------------------------------------------------------------------------------------------------------------------
 VPosition::VPosition(const VContour &gContour, int j, const VLayoutPiece &piece, int i, std::atomic_bool *stop,
@@ -100,6 +101,7 @@ VPosition::VPosition(const VContour &gContour, int j, const VLayoutPiece &piece,
 //---------------------------------------------------------------------------------------------------------------------
 void VPosition::run()
 {
+    V_TRACE_SCOPE("VPosition::run", "layout");
     if (stop->load())
     {
         return;
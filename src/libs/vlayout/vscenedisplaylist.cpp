@@ -0,0 +1,301 @@
+/***************************************************************************
+ **  @file   vscenedisplaylist.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "vscenedisplaylist.h"
+
+#include <QGraphicsItem>
+#include <QGraphicsScene>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+#include <QtMath>
+#include <algorithm>
+#include <functional>
+
+namespace
+{
+// Number of grid cells along the longest side of recorded items
+const int gridCells = 16;
+
+//---------------------------------------------------------------------------------------------------------------------
+bool StacksBehindParent(const QGraphicsItem *item)
+{
+    return (item->flags() & QGraphicsItem::ItemStacksBehindParent) || item->zValue() < 0;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VSceneDisplayList::VSceneDisplayList()
+    : m_entries(),
+      m_background(Qt::NoBrush),
+      m_gridRect(),
+      m_cellSize(1),
+      m_columns(0),
+      m_rows(0),
+      m_cells()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Record records all visible items of the scene in the order scene paints them.
+ * @param scene the scene.
+ */
+void VSceneDisplayList::Record(const QGraphicsScene *scene)
+{
+    Clear();
+    if (scene == nullptr)
+    {
+        return;
+    }
+
+    m_background = scene->backgroundBrush();
+
+    const QList<QGraphicsItem *> items = scene->items(Qt::AscendingOrder);
+    m_entries.reserve(items.size());
+    for (auto *item : items)
+    {
+        Append(item);
+    }
+
+    BuildIndex();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Record records items that do not belong to a scene together with their children.
+ * @param items top level items in paint order. Item coordinates are treated as scene coordinates.
+ */
+void VSceneDisplayList::Record(const QVector<QGraphicsItem *> &items)
+{
+    Clear();
+
+    std::function<void (QGraphicsItem *)> appendTree = [this, &appendTree](QGraphicsItem *item)
+    {
+        const QList<QGraphicsItem *> children = item->childItems();
+        for (auto *child : children)
+        {
+            if (StacksBehindParent(child))
+            {
+                appendTree(child);
+            }
+        }
+
+        Append(item);
+
+        for (auto *child : children)
+        {
+            if (not StacksBehindParent(child))
+            {
+                appendTree(child);
+            }
+        }
+    };
+
+    for (auto *item : items)
+    {
+        if (item != nullptr && item->parentItem() == nullptr)
+        {
+            appendTree(item);
+        }
+    }
+
+    BuildIndex();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Render paints recorded items that intersect source rect into target rect on the painter.
+ *
+ * Mapping is the same as QGraphicsScene::render() with Qt::IgnoreAspectRatio.
+ *
+ * @param overlay optional list painted as if its items were children of overlayParent. If overlayParent was not
+ * painted the overlay goes on top.
+ */
+void VSceneDisplayList::Render(QPainter *painter, const QRectF &target, const QRectF &source,
+                               const VSceneDisplayList *overlay, const QGraphicsItem *overlayParent) const
+{
+    if (painter == nullptr || source.isEmpty() || target.isEmpty())
+    {
+        return;
+    }
+
+    painter->save();
+    painter->setClipRect(target, Qt::IntersectClip);
+
+    if (m_background.style() != Qt::NoBrush)
+    {
+        painter->fillRect(target, m_background);
+    }
+
+    const QTransform tile = QTransform::fromTranslate(-source.x(), -source.y())
+            * QTransform::fromScale(target.width() / source.width(), target.height() / source.height())
+            * QTransform::fromTranslate(target.x(), target.y());
+
+    PaintEntries(painter, tile * painter->worldTransform(), painter->opacity(), source, overlay, overlayParent);
+
+    painter->restore();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VSceneDisplayList::IsEmpty() const
+{
+    return m_entries.isEmpty();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSceneDisplayList::Clear()
+{
+    m_entries.clear();
+    m_background = QBrush(Qt::NoBrush);
+    m_gridRect = QRectF();
+    m_cellSize = 1;
+    m_columns = 0;
+    m_rows = 0;
+    m_cells.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSceneDisplayList::Append(QGraphicsItem *item)
+{
+    if (item == nullptr || not item->isVisible() || (item->flags() & QGraphicsItem::ItemHasNoContents))
+    {
+        return;
+    }
+
+    const qreal opacity = item->effectiveOpacity();
+    if (qFuzzyIsNull(opacity))
+    {
+        return;
+    }
+
+    const QTransform transform = item->sceneTransform();
+    m_entries.append({item, transform, opacity, transform.mapRect(item->boundingRect())});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSceneDisplayList::BuildIndex()
+{
+    for (const Entry &entry : qAsConst(m_entries))
+    {
+        m_gridRect |= entry.bounds;
+    }
+
+    if (m_gridRect.isEmpty())
+    {
+        return;
+    }
+
+    m_cellSize = qMax(qMax(m_gridRect.width(), m_gridRect.height()) / gridCells, 1.0);
+    m_columns = qMax(qCeil(m_gridRect.width() / m_cellSize), 1);
+    m_rows = qMax(qCeil(m_gridRect.height() / m_cellSize), 1);
+    m_cells.fill(QVector<int>(), m_columns * m_rows);
+
+    for (int i = 0; i < m_entries.size(); ++i)
+    {
+        const QRectF &bounds = m_entries.at(i).bounds;
+        const int left = qBound(0, qFloor((bounds.left() - m_gridRect.left()) / m_cellSize), m_columns - 1);
+        const int right = qBound(0, qFloor((bounds.right() - m_gridRect.left()) / m_cellSize), m_columns - 1);
+        const int top = qBound(0, qFloor((bounds.top() - m_gridRect.top()) / m_cellSize), m_rows - 1);
+        const int bottom = qBound(0, qFloor((bounds.bottom() - m_gridRect.top()) / m_cellSize), m_rows - 1);
+
+        for (int row = top; row <= bottom; ++row)
+        {
+            for (int column = left; column <= right; ++column)
+            {
+                m_cells[row * m_columns + column].append(i);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Query returns indexes of recorded items that intersect the rect, in paint order.
+ */
+QVector<int> VSceneDisplayList::Query(const QRectF &rect) const
+{
+    QVector<int> result;
+    if (m_cells.isEmpty() || not rect.intersects(m_gridRect))
+    {
+        return result;
+    }
+
+    const QRectF area = rect & m_gridRect;
+    const int left = qBound(0, qFloor((area.left() - m_gridRect.left()) / m_cellSize), m_columns - 1);
+    const int right = qBound(0, qFloor((area.right() - m_gridRect.left()) / m_cellSize), m_columns - 1);
+    const int top = qBound(0, qFloor((area.top() - m_gridRect.top()) / m_cellSize), m_rows - 1);
+    const int bottom = qBound(0, qFloor((area.bottom() - m_gridRect.top()) / m_cellSize), m_rows - 1);
+
+    for (int row = top; row <= bottom; ++row)
+    {
+        for (int column = left; column <= right; ++column)
+        {
+            const QVector<int> &cell = m_cells.at(row * m_columns + column);
+            for (int index : cell)
+            {
+                if (m_entries.at(index).bounds.intersects(rect))
+                {
+                    result.append(index);
+                }
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSceneDisplayList::PaintEntries(QPainter *painter, const QTransform &base, qreal baseOpacity, const QRectF &source,
+                                     const VSceneDisplayList *overlay, const QGraphicsItem *overlayParent) const
+{
+    bool overlayPainted = false;
+    QStyleOptionGraphicsItem option;
+    const QVector<int> visible = Query(source);
+    for (int index : visible)
+    {
+        const Entry &entry = m_entries.at(index);
+
+        painter->save();
+        painter->setWorldTransform(entry.transform * base);
+        painter->setOpacity(baseOpacity * entry.opacity);
+
+        option.state = entry.item->isEnabled() ? QStyle::State_Enabled : QStyle::State_None;
+        option.exposedRect = entry.item->boundingRect();
+        entry.item->paint(painter, &option, nullptr);
+
+        painter->restore();
+
+        if (overlay != nullptr && entry.item == overlayParent)
+        {
+            overlay->PaintEntries(painter, base, baseOpacity, source, nullptr, nullptr);
+            overlayPainted = true;
+        }
+    }
+
+    if (overlay != nullptr && not overlayPainted)
+    {
+        overlay->PaintEntries(painter, base, baseOpacity, source, nullptr, nullptr);
+    }
+}
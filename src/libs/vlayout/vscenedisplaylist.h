@@ -0,0 +1,88 @@
+/***************************************************************************
+ **  @file   vscenedisplaylist.h
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#ifndef VSCENEDISPLAYLIST_H
+#define VSCENEDISPLAYLIST_H
+
+#include <QBrush>
+#include <QRectF>
+#include <QTransform>
+#include <QVector>
+#include <QtGlobal>
+
+class QGraphicsItem;
+class QGraphicsScene;
+class QPainter;
+
+/**
+ * @brief The VSceneDisplayList class records paint order of graphics items once and replays only items that intersect
+ * a requested rect.
+ *
+ * Printing a sheet as a poster renders the same scene for every tile. Recording keeps scene transforms, effective
+ * opacity and bounding rects of visible items in stacking order and puts them into a uniform grid, so each tile paints
+ * only its own items and the scene stays untouched while pages are produced.
+ *
+ * The list keeps raw pointers to items, they must outlive it. Clipping of children to a parent shape is not supported,
+ * layout sheets do not use it.
+ */
+class VSceneDisplayList
+{
+public:
+    VSceneDisplayList();
+
+    void Record(const QGraphicsScene *scene);
+    void Record(const QVector<QGraphicsItem *> &items);
+
+    void Render(QPainter *painter, const QRectF &target, const QRectF &source,
+                const VSceneDisplayList *overlay = nullptr, const QGraphicsItem *overlayParent = nullptr) const;
+
+    bool IsEmpty() const;
+    void Clear();
+
+private:
+    struct Entry
+    {
+        QGraphicsItem *item;
+        QTransform transform;
+        qreal opacity;
+        QRectF bounds;
+    };
+
+    QVector<Entry> m_entries;
+    QBrush m_background;
+
+    QRectF m_gridRect;
+    qreal m_cellSize;
+    int m_columns;
+    int m_rows;
+    QVector<QVector<int>> m_cells;
+
+    void Append(QGraphicsItem *item);
+    void BuildIndex();
+    QVector<int> Query(const QRectF &rect) const;
+    void PaintEntries(QPainter *painter, const QTransform &base, qreal baseOpacity, const QRectF &source,
+                      const VSceneDisplayList *overlay, const QGraphicsItem *overlayParent) const;
+};
+
+#endif // VSCENEDISPLAYLIST_H
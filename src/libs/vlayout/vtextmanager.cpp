@@ -29,8 +29,10 @@
 #include <QDate>
 #include <QFileInfo>
 #include <QFontMetrics>
+#include <QHash>
 #include <QLatin1String>
 #include <QRegularExpression>
+#include <QSharedPointer>
 #include <QApplication>
 #include <QDebug>
 
@@ -57,6 +59,87 @@ QList<TextLine> VTextManager::m_patternLabelLines = QList<TextLine>();
 
 namespace
 {
+const int maxCachedFonts = 64;
+const int maxCachedLines = 1024;
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The FontMetricsCache class keeps advance widths of label lines for each font, pixel size and style.
+ *
+ * Fitting tries several sizes for the same lines and labels are fitted again on every drag, so each line is shaped only
+ * once per size. Every thread has its own cache, which makes label fitting safe from piece preparation threads without
+ * locking.
+ */
+class FontMetricsCache
+{
+public:
+    FontMetricsCache()
+        : m_fonts()
+    {}
+
+    int Width(const QFont &base, int pixelSize, bool bold, bool italic, const QString &text)
+    {
+        QFont font = base;
+        font.setPixelSize(pixelSize);
+        font.setBold(bold);
+        font.setItalic(italic);
+
+        const QString key = font.key();
+        QSharedPointer<FontWidths> widths = m_fonts.value(key);
+        if (widths.isNull())
+        {
+            if (m_fonts.size() >= maxCachedFonts)
+            {
+                m_fonts.clear();
+            }
+            widths = QSharedPointer<FontWidths>(new FontWidths(font));
+            m_fonts.insert(key, widths);
+        }
+
+        auto it = widths->lines.constFind(text);
+        if (it != widths->lines.constEnd())
+        {
+            return it.value();
+        }
+
+        if (widths->lines.size() >= maxCachedLines)
+        {
+            widths->lines.clear();
+        }
+
+        const int width = widths->metrics.horizontalAdvance(text);
+        widths->lines.insert(text, width);
+        return width;
+    }
+
+    static FontMetricsCache &Instance()
+    {
+        static thread_local FontMetricsCache cache;
+        return cache;
+    }
+
+private:
+    Q_DISABLE_COPY(FontMetricsCache)
+
+    struct FontWidths
+    {
+        explicit FontWidths(const QFont &font)
+            : metrics(font),
+              lines()
+        {}
+
+        QFontMetrics metrics;
+        QHash<QString, int> lines;
+    };
+
+    QHash<QString, QSharedPointer<FontWidths>> m_fonts;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+int LineWidth(const QFont &font, int fontSize, const TextLine &line)
+{
+    return FontMetricsCache::Instance().Width(font, fontSize + line.m_iFontSize, line.bold, line.italic, line.m_text);
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 QMap<QString, QString> PreparePlaceholders(const VAbstractPattern *doc)
@@ -290,44 +373,40 @@ void VTextManager::FitFontSize(qreal fW, qreal fH)
         iFS = MIN_FONT_SIZE;
     }
 
-    // get ratio between char width and height
-
     int iMaxLen = 0;
     TextLine maxLine;
-    QFont fnt;
     for (int i = 0; i < GetSourceLinesCount(); ++i)
     {
         const TextLine& tl = GetSourceLine(i);
-        fnt = m_font;
-        fnt.setPixelSize(iFS + tl.m_iFontSize);
-        fnt.setBold(tl.bold);
-        fnt.setItalic(tl.italic);
-        QFontMetrics fm(fnt);
-        const int iTW = fm.horizontalAdvance(tl.m_text);
+        const int iTW = LineWidth(m_font, iFS, tl);
         if (iTW > iMaxLen)
         {
             iMaxLen = iTW;
             maxLine = tl;
         }
     }
+
     if (iMaxLen > fW)
     {
-        QFont fnt = m_font;
-        fnt.setBold(maxLine.bold);
-        fnt.setItalic(maxLine.italic);
-
-        int lineLength = 0;
-        do
+        // Width grows with the font size, so look for the biggest size that fits with a binary search
+        int low = MIN_FONT_SIZE;
+        int high = iFS - 1;
+        iFS = MIN_FONT_SIZE;
+        while (low <= high)
         {
-            --iFS;
-            fnt.setPixelSize(iFS + maxLine.m_iFontSize);
-            QFontMetrics fm(fnt);
-            lineLength = fm.horizontalAdvance(maxLine.m_text);
+            const int middle = low + (high - low) / 2;
+            if (LineWidth(m_font, middle, maxLine) <= fW)
+            {
+                iFS = middle;
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle - 1;
+            }
         }
-        while (lineLength > fW && iFS > MIN_FONT_SIZE);
     }
     SetFontSize(iFS);
-    qDebug() << "Font size" << GetSourceLinesCount() << iFS;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -133,6 +133,8 @@ const QString SINGLE_OPTION_TOP_MARGIN      = QStringLiteral("T");
 const QString LONG_OPTION_BOTTOM_MARGIN     = QStringLiteral("bmargin");
 const QString SINGLE_OPTION_BOTTOM_MARGIN   = QStringLiteral("B");
 
+const QString LONG_OPTION_TRACE             = QStringLiteral("trace");
+
 //---------------------------------------------------------------------------------------------------------------------
 QStringList AllKeys()
 {
@@ -162,6 +164,7 @@ QStringList AllKeys()
          << LONG_OPTION_RIGHT_MARGIN << SINGLE_OPTION_RIGHT_MARGIN
          << LONG_OPTION_TOP_MARGIN << SINGLE_OPTION_TOP_MARGIN
          << LONG_OPTION_BOTTOM_MARGIN << SINGLE_OPTION_BOTTOM_MARGIN
+         << LONG_OPTION_TRACE
          << LONG_OPTION_NO_HDPI_SCALING;
 
     return list;
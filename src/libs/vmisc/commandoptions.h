@@ -130,6 +130,8 @@ extern const QString SINGLE_OPTION_TOP_MARGIN;
 extern const QString LONG_OPTION_BOTTOM_MARGIN;
 extern const QString SINGLE_OPTION_BOTTOM_MARGIN;
 
+extern const QString LONG_OPTION_TRACE;
+
 QStringList AllKeys();
 
 #endif // COMMANDOPTIONS_H
@@ -364,6 +364,39 @@ QMarginsF UnitConvertor(const QMarginsF &margins, const Unit &from, const Unit &
     return QMarginsF(left, top, right, bottom);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UnitFactor return factor that converts values from one unit to another.
+ *
+ * All supported units are linear, so converting an array is a multiplication by one precomputed factor.
+ */
+qreal UnitFactor(const Unit &from, const Unit &to)
+{
+    if (from == to)
+    {
+        return 1.0;
+    }
+    return UnitConvertor(1.0, from, to);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MapPoints scale and translate points: x' = x * scaleX + dx, y' = y * scaleY + dy.
+ *
+ * The loop has no branches, so the compiler can vectorize it. Used to convert whole polygons to export coordinates.
+ */
+QVector<QPointF> MapPoints(const QVector<QPointF> &points, qreal scaleX, qreal scaleY, qreal dx, qreal dy)
+{
+    QVector<QPointF> result(points.size());
+    const QPointF *src = points.constData();
+    QPointF *dst = result.data();
+    for (int i = 0; i < points.size(); ++i)
+    {
+        dst[i] = QPointF(src[i].x() * scaleX + dx, src[i].y() * scaleY + dy);
+    }
+    return result;
+}
+
 
 //---------------------------------------------------------------------------------------------------------------------
 QStringList SupportedLocales()
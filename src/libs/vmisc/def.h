@@ -34,6 +34,7 @@
 #include <QLineF>
 #include <QString>
 #include <QStringList>
+#include <QVector>
 #include <Qt>
 #include <QtGlobal>
 #include <QPrinter>
@@ -484,6 +485,10 @@ Q_REQUIRED_RESULT double FromPixel(double pix, const Unit &unit);
 
 Q_REQUIRED_RESULT qreal UnitConvertor(qreal value, const Unit &from, const Unit &to);
 Q_REQUIRED_RESULT QMarginsF UnitConvertor(const QMarginsF &margins, const Unit &from, const Unit &to);
+Q_REQUIRED_RESULT qreal UnitFactor(const Unit &from, const Unit &to);
+
+Q_REQUIRED_RESULT QVector<QPointF> MapPoints(const QVector<QPointF> &points, qreal scaleX, qreal scaleY, qreal dx = 0,
+                                             qreal dy = 0);
 
 void InitLanguages(QComboBox *combobox);
 Q_REQUIRED_RESULT QStringList SupportedLocales();
@@ -157,6 +157,10 @@ const QString settingGraphicsViewWireframe               = QStringLiteral("graph
 const QString settingGraphicsViewShowControlPoints       = QStringLiteral("graphicsview/showControlPoints");
 const QString settingGraphicsViewShowAnchorPoints        = QStringLiteral("graphicsview/showAnchorPoints");
 const QString settingGraphicsUseToolColor                = QStringLiteral("graphicsview/useToolColor");
+const QString settingGraphicsViewLodSimplePoints         = QStringLiteral("graphicsview/lodSimplePoints");
+const QString settingGraphicsViewLodSimpleCurves         = QStringLiteral("graphicsview/lodSimpleCurves");
+const QString settingGraphicsViewLodCurveTolerance       = QStringLiteral("graphicsview/lodCurveTolerance");
+const QString settingGraphicsViewLodMinTextHeight        = QStringLiteral("graphicsview/lodMinTextHeight");
 
 const QString settingPatternUndo                         = QStringLiteral("pattern/undo");
 const QString settingSelectionSound                      = QStringLiteral("pattern/selectionSound");
@@ -334,8 +338,70 @@ QString PrepareStandardFiles(const QString &currentPath, const QString &standard
 //---------------------------------------------------------------------------------------------------------------------
 VCommonSettings::VCommonSettings(Format format, Scope scope, const QString &organization,
                             const QString &application, QObject *parent)
-    :QSettings(format, scope, organization, application, parent)
-{}
+    :QSettings(format, scope, organization, application, parent),
+      m_snapshot()
+{
+    PublishSnapshot();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Snapshot returns current typed values of frequently read settings.
+ *
+ * Returned snapshot never changes. Keep it to read several values at once or to pass settings to a worker thread.
+ */
+std::shared_ptr<const VSettingsSnapshot> VCommonSettings::Snapshot() const
+{
+    return std::atomic_load(&m_snapshot);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VSettingsSnapshot VCommonSettings::ReadSnapshot() const
+{
+    VSettingsSnapshot snapshot;
+    snapshot.osSeparator = value(settingConfigurationOsSeparator, 1).toBool();
+    snapshot.showSeamAllowances = value(settingShowSeamAllowances, true).toBool();
+    snapshot.showLabels = value(settingShowLabels, true).toBool();
+    snapshot.showGrainlines = value(settingShowGrainlines, true).toBool();
+    snapshot.useToolColor = value(settingGraphicsUseToolColor, false).toBool();
+    snapshot.wireframe = value(settingGraphicsViewWireframe, false).toBool();
+    snapshot.lodSimplePoints = value(settingGraphicsViewLodSimplePoints, 0.1).toReal();
+    snapshot.lodSimpleCurves = value(settingGraphicsViewLodSimpleCurves, 0.5).toReal();
+    snapshot.lodCurveTolerance = value(settingGraphicsViewLodCurveTolerance, 0.5).toReal();
+    snapshot.lodMinTextHeight = value(settingGraphicsViewLodMinTextHeight, 4).toReal();
+    snapshot.labelFont = qvariant_cast<QFont>(value(settingPatternLabelFont, QApplication::font()));
+    snapshot.pointNameFont = qvariant_cast<QFont>(value(settingPatternPointNameFont, QApplication::font()));
+    snapshot.pointNameColor = value(settingGraphicsViewPointNameColor, "Black").toString();
+    snapshot.pointNameHoverColor = value(settingGraphicsViewPointNameHoverColor, "Magenta").toString();
+    snapshot.primarySupportColor = value(settingGraphicsViewPrimaryColor, "Magenta").toString();
+    snapshot.secondarySupportColor = value(settingGraphicsViewSecondaryColor, "Forest Green").toString();
+    snapshot.tertiarySupportColor = value(settingGraphicsViewTertiaryColor, "Navy").toString();
+    snapshot.defaultLineColor = value(settingGraphicsViewDefaultLineColor, "black").toString();
+    snapshot.defaultLineType = value(settingGraphicsViewDefaultLineType, "solidLine").toString();
+    snapshot.defaultLineWeight = value(settingGraphicsViewDefaultLineWeight, 1.20).toReal();
+    snapshot.defaultSeamColor = value(settingDefaultSeamColor, "black").toString();
+    snapshot.defaultSeamLinetype = value(settingDefaultSeamLinetype, "solidLine").toString();
+    snapshot.defaultSeamLineweight = value(settingDefaultSeamLineweight, 1.20).toReal();
+    snapshot.defaultCutColor = value(settingDefaultCutColor, "black").toString();
+    snapshot.defaultCutLinetype = value(settingDefaultCutLinetype, "solidLine").toString();
+    snapshot.defaultCutLineweight = value(settingDefaultCutLineweight, 1.20).toReal();
+    snapshot.defaultInternalColor = value(settingDefaultInternalColor, "black").toString();
+    snapshot.defaultInternalLinetype = value(settingDefaultInternalLinetype, "solidLine").toString();
+    snapshot.defaultInternalLineweight = value(settingDefaultInternalLineweight, 1.20).toReal();
+    snapshot.defaultCutoutColor = value(settingDefaultCutoutColor, "black").toString();
+    snapshot.defaultCutoutLinetype = value(settingDefaultCutoutLinetype, "solidLine").toString();
+    snapshot.defaultCutoutLineweight = value(settingDefaultCutoutLineweight, 1.20).toReal();
+    snapshot.defaultNotchColor = value(settingDefaultNotchColor, "black").toString();
+    snapshot.defaultLabelColor = value(settingDefaultLabelColor, "black").toString();
+    snapshot.defaultGrainlineColor = value(settingDefaultGrainlineColor, "black").toString();
+    return snapshot;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VCommonSettings::PublishSnapshot()
+{
+    std::atomic_store(&m_snapshot, std::shared_ptr<const VSettingsSnapshot>(new VSettingsSnapshot(ReadSnapshot())));
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::SharePath(const QString &shareItem)
@@ -546,13 +612,14 @@ void VCommonSettings::setShowWelcome(const bool &value)
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::GetOsSeparator() const
 {
-    return value(settingConfigurationOsSeparator, 1).toBool();
+    return Snapshot()->osSeparator;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetOsSeparator(const bool &value)
 {
     setValue(settingConfigurationOsSeparator, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1013,25 +1080,27 @@ void VCommonSettings::setZoomRBNegativeColor(const QString &value)
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getPointNameColor() const
 {
-    return value(settingGraphicsViewPointNameColor, "Black").toString();
+    return Snapshot()->pointNameColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPointNameColor(const QString &value)
 {
     setValue(settingGraphicsViewPointNameColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getPointNameHoverColor() const
 {
-    return value(settingGraphicsViewPointNameHoverColor, "Magenta").toString();
+    return Snapshot()->pointNameHoverColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPointNameHoverColor(const QString &value)
 {
     setValue(settingGraphicsViewPointNameHoverColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1049,73 +1118,79 @@ void VCommonSettings::setAxisOrginColor(const QString &value)
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultLineColor() const
 {
-    return value(settingGraphicsViewDefaultLineColor, "black").toString();
+    return Snapshot()->defaultLineColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultLineColor(const QString &value)
 {
     setValue(settingGraphicsViewDefaultLineColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultLineWeight() const
 {
-    return value(settingGraphicsViewDefaultLineWeight, 1.20).toReal();
+    return Snapshot()->defaultLineWeight;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultLineWeight(const qreal &value)
 {
     setValue(settingGraphicsViewDefaultLineWeight, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultLineType() const
 {
-    return value(settingGraphicsViewDefaultLineType, "solidLine").toString();
+    return Snapshot()->defaultLineType;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultLineType(const QString &value)
 {
     setValue(settingGraphicsViewDefaultLineType, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getPrimarySupportColor() const
 {
-    return value(settingGraphicsViewPrimaryColor, "Magenta").toString();
+    return Snapshot()->primarySupportColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPrimarySupportColor(const QString &value)
 {
     setValue(settingGraphicsViewPrimaryColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getSecondarySupportColor() const
 {
-    return value(settingGraphicsViewSecondaryColor, "Forest Green").toString();
+    return Snapshot()->secondarySupportColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setSecondarySupportColor(const QString &value)
 {
     setValue(settingGraphicsViewSecondaryColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getTertiarySupportColor() const
 {
-    return value(settingGraphicsViewTertiaryColor, "Navy").toString();
+    return Snapshot()->tertiarySupportColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setTertiarySupportColor(const QString &value)
 {
     setValue(settingGraphicsViewTertiaryColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1527,13 +1602,14 @@ void VCommonSettings::setDefaultNotchType(const QString &value)
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultNotchColor() const
 {
-   return value(settingDefaultNotchColor, "black").toString();
+    return Snapshot()->defaultNotchColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultNotchColor(const QString &value)
 {
     setValue(settingDefaultNotchColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1676,157 +1752,170 @@ double VCommonSettings::GetDefaultSeamAllowance()
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultSeamColor() const
 {
-   return value(settingDefaultSeamColor, "black").toString();
+    return Snapshot()->defaultSeamColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultSeamColor(const QString &value)
 {
     setValue(settingDefaultSeamColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultSeamLinetype() const
 {
-   return value(settingDefaultSeamLinetype, "solidLine").toString();
+    return Snapshot()->defaultSeamLinetype;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultSeamLinetype(const QString &value)
 {
     setValue(settingDefaultSeamLinetype, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultSeamLineweight() const
 {
-   return value(settingDefaultSeamLineweight, 1.20).toReal();
+    return Snapshot()->defaultSeamLineweight;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultSeamLineweight(const qreal &value)
 {
     setValue(settingDefaultSeamLineweight, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultCutColor() const
 {
-   return value(settingDefaultCutColor, "black").toString();
+    return Snapshot()->defaultCutColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutColor(const QString &value)
 {
     setValue(settingDefaultCutColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultCutLinetype() const
 {
-   return value(settingDefaultCutLinetype, "solidLine").toString();
+    return Snapshot()->defaultCutLinetype;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutLinetype(const QString &value)
 {
     setValue(settingDefaultCutLinetype, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultCutLineweight() const
 {
-   return value(settingDefaultCutLineweight, 1.20).toReal();
+    return Snapshot()->defaultCutLineweight;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutLineweight(const qreal &value)
 {
     setValue(settingDefaultCutLineweight, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultInternalColor() const
 {
-   return value(settingDefaultInternalColor, "black").toString();
+    return Snapshot()->defaultInternalColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultInternalColor(const QString &value)
 {
     setValue(settingDefaultInternalColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultInternalLinetype() const
 {
-   return value(settingDefaultInternalLinetype, "solidLine").toString();
+    return Snapshot()->defaultInternalLinetype;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultInternalLinetype(const QString &value)
 {
     setValue(settingDefaultInternalLinetype, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultInternalLineweight() const
 {
-   return value(settingDefaultInternalLineweight, 1.20).toReal();
+    return Snapshot()->defaultInternalLineweight;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultInternalLineweight(const qreal &value)
 {
     setValue(settingDefaultInternalLineweight, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultCutoutColor() const
 {
-   return value(settingDefaultCutoutColor, "black").toString();
+    return Snapshot()->defaultCutoutColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutoutColor(const QString &value)
 {
     setValue(settingDefaultCutoutColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultCutoutLinetype() const
 {
-   return value(settingDefaultCutoutLinetype, "solidLine").toString();
+    return Snapshot()->defaultCutoutLinetype;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutoutLinetype(const QString &value)
 {
     setValue(settingDefaultCutoutLinetype, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultCutoutLineweight() const
 {
-   return value(settingDefaultCutoutLineweight, 1.20).toReal();
+    return Snapshot()->defaultCutoutLineweight;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutoutLineweight(const qreal &value)
 {
     setValue(settingDefaultCutoutLineweight, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showSeamAllowances() const
 {
-    return value(settingShowSeamAllowances, true).toBool();
+    return Snapshot()->showSeamAllowances;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowSeamAllowances(const bool &value)
 {
     setValue(settingShowSeamAllowances, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1844,13 +1933,14 @@ void VCommonSettings::setDefaultSeamAllowanceVisibilty(const bool &value)
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showGrainlines() const
 {
-    return value(settingShowGrainlines, true).toBool();
+    return Snapshot()->showGrainlines;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowGrainlines(const bool &value)
 {
     setValue(settingShowGrainlines, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1880,13 +1970,14 @@ void VCommonSettings::setDefaultGrainlineLength(const qreal &value)
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultGrainlineColor() const
 {
-   return value(settingDefaultGrainlineColor, "black").toString();
+    return Snapshot()->defaultGrainlineColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultGrainlineColor(const QString &value)
 {
     setValue(settingDefaultGrainlineColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1904,13 +1995,14 @@ void VCommonSettings::setDefaultGrainlineLineweight(const qreal &value)
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showLabels() const
 {
-    return value(settingShowLabels, true).toBool();
+    return Snapshot()->showLabels;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowLabels(const bool &value)
 {
     setValue(settingShowLabels, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1964,25 +2056,27 @@ void VCommonSettings::setDefaultLabelHeight(const qreal &value)
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultLabelColor() const
 {
-   return value(settingDefaultLabelColor, "black").toString();
+    return Snapshot()->defaultLabelColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultLabelColor(const QString &value)
 {
     setValue(settingDefaultLabelColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QFont VCommonSettings::getLabelFont() const
 {
-    return qvariant_cast<QFont>(value(settingPatternLabelFont, QApplication::font()));
+    return Snapshot()->labelFont;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setLabelFont(const QFont &f)
 {
     setValue(settingPatternLabelFont, f);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2000,13 +2094,14 @@ void VCommonSettings::setGuiFont(const QFont &f)
 //---------------------------------------------------------------------------------------------------------------------
 QFont VCommonSettings::getPointNameFont() const
 {
-    return qvariant_cast<QFont>(value(settingPatternPointNameFont, QApplication::font()));
+    return Snapshot()->pointNameFont;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPointNameFont(const QFont &f)
 {
     setValue(settingPatternPointNameFont, f);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2036,13 +2131,50 @@ void VCommonSettings::setShowAxisOrigin(bool value)
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::isWireframe() const
 {
-    return value(settingGraphicsViewWireframe, false).toBool();
+    return Snapshot()->wireframe;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setWireframe(bool value)
 {
     setValue(settingGraphicsViewWireframe, value);
+    PublishSnapshot();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getLodSimplePoints level of detail below which points are drawn as single pixels. Level 1 means 100% zoom.
+ */
+qreal VCommonSettings::getLodSimplePoints() const
+{
+    return Snapshot()->lodSimplePoints;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getLodSimpleCurves level of detail below which curves are drawn as decimated polylines.
+ */
+qreal VCommonSettings::getLodSimpleCurves() const
+{
+    return Snapshot()->lodSimpleCurves;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getLodCurveTolerance maximal deviation of a decimated curve on screen in pixels.
+ */
+qreal VCommonSettings::getLodCurveTolerance() const
+{
+    return Snapshot()->lodCurveTolerance;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getLodMinTextHeight text lower than this on screen in pixels is replaced by placeholder bars.
+ */
+qreal VCommonSettings::getLodMinTextHeight() const
+{
+    return Snapshot()->lodMinTextHeight;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2072,13 +2204,14 @@ void VCommonSettings::setShowAnchorPoints(bool value)
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getUseToolColor() const
 {
-    return value(settingGraphicsUseToolColor, false).toBool();
+    return Snapshot()->useToolColor;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setUseToolColor(bool value)
 {
     setValue(settingGraphicsUseToolColor, value);
+    PublishSnapshot();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -57,6 +57,7 @@
 #define VCOMMONSETTINGS_H
 
 #include <QByteArray>
+#include <QFont>
 #include <QMetaObject>
 #include <QObject>
 #include <QSettings>
@@ -64,9 +65,55 @@
 #include <QString>
 #include <QStringList>
 #include <QtGlobal>
+#include <memory>
 
 #include "../vlayout/vbank.h"
 
+/**
+ * @brief The VSettingsSnapshot struct holds typed values of settings read in hot paths.
+ *
+ * A snapshot is immutable. VCommonSettings reads it once and publishes a new one each time one of these settings
+ * changes, so readers get plain fields without QSettings lookups and worker threads can keep a snapshot safely.
+ */
+struct VSettingsSnapshot
+{
+    bool     osSeparator;
+    bool     showSeamAllowances;
+    bool     showLabels;
+    bool     showGrainlines;
+    bool     useToolColor;
+    bool     wireframe;
+    qreal    lodSimplePoints;
+    qreal    lodSimpleCurves;
+    qreal    lodCurveTolerance;
+    qreal    lodMinTextHeight;
+    QFont    labelFont;
+    QFont    pointNameFont;
+    QString  pointNameColor;
+    QString  pointNameHoverColor;
+    QString  primarySupportColor;
+    QString  secondarySupportColor;
+    QString  tertiarySupportColor;
+    QString  defaultLineColor;
+    QString  defaultLineType;
+    qreal    defaultLineWeight;
+    QString  defaultSeamColor;
+    QString  defaultSeamLinetype;
+    qreal    defaultSeamLineweight;
+    QString  defaultCutColor;
+    QString  defaultCutLinetype;
+    qreal    defaultCutLineweight;
+    QString  defaultInternalColor;
+    QString  defaultInternalLinetype;
+    qreal    defaultInternalLineweight;
+    QString  defaultCutoutColor;
+    QString  defaultCutoutLinetype;
+    qreal    defaultCutoutLineweight;
+    QString  defaultNotchColor;
+    QString  defaultLabelColor;
+    QString  defaultGrainlineColor;
+};
+
 class VCommonSettings : public QSettings
 {
     Q_OBJECT
@@ -74,6 +121,8 @@ class VCommonSettings : public QSettings
                          VCommonSettings(Format format, Scope scope, const QString &organization,
                                          const QString &application = QString(), QObject *parent = nullptr);
 
+    std::shared_ptr<const VSettingsSnapshot> Snapshot() const;
+
     static QString       SharePath(const QString &shareItem);
     static QString       MultisizeTablesPath();
     static QString       StandardTemplatesPath();
@@ -469,6 +518,11 @@ class VCommonSettings : public QSettings
     bool                 isWireframe() const;
     void                 setWireframe(bool value);
 
+    qreal                getLodSimplePoints() const;
+    qreal                getLodSimpleCurves() const;
+    qreal                getLodCurveTolerance() const;
+    qreal                getLodMinTextHeight() const;
+
     bool                 getShowControlPoints() const;
     void                 setShowControlPoints(bool value);
 
@@ -497,6 +551,11 @@ class VCommonSettings : public QSettings
 
 private:
     Q_DISABLE_COPY(VCommonSettings)
+
+    std::shared_ptr<const VSettingsSnapshot> m_snapshot;
+
+    VSettingsSnapshot ReadSnapshot() const;
+    void              PublishSnapshot();
 };
 
 #endif // VCOMMONSETTINGS_H
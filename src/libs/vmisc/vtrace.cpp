@@ -0,0 +1,247 @@
+/***************************************************************************
+ **  @file   vtrace.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "vtrace.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace
+{
+struct TraceEvent
+{
+    const char *name;
+    const char *category;
+    qint64 start;
+    qint64 duration;
+};
+
+const int traceChunkSize = 4096;
+
+struct TraceChunk
+{
+    TraceChunk()
+        : events(),
+          count(0),
+          next(nullptr)
+    {}
+
+    TraceEvent events[traceChunkSize];
+    std::atomic<int> count;
+    std::atomic<TraceChunk *> next;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The TraceBuffer struct is the event buffer of a single thread.
+ *
+ * Only the owner thread appends events. Chunks are linked and never moved, a reader walks them and reads as many events
+ * as were published by the chunk counter.
+ */
+struct TraceBuffer
+{
+    TraceBuffer(int id, const QByteArray &name)
+        : threadId(id),
+          threadName(name),
+          head(new TraceChunk),
+          tail(head)
+    {}
+
+    ~TraceBuffer()
+    {
+        TraceChunk *chunk = head;
+        while (chunk != nullptr)
+        {
+            TraceChunk *next = chunk->next.load(std::memory_order_relaxed);
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    void Append(const TraceEvent &event)
+    {
+        int count = tail->count.load(std::memory_order_relaxed);
+        if (count == traceChunkSize)
+        {
+            TraceChunk *chunk = new TraceChunk;
+            tail->next.store(chunk, std::memory_order_release);
+            tail = chunk;
+            count = 0;
+        }
+
+        tail->events[count] = event;
+        tail->count.store(count + 1, std::memory_order_release);
+    }
+
+    const int threadId;
+    const QByteArray threadName;
+    TraceChunk * const head;
+    TraceChunk *tail;
+
+private:
+    Q_DISABLE_COPY(TraceBuffer)
+};
+
+std::atomic<bool> recording(false);
+QElapsedTimer traceClock;
+
+//---------------------------------------------------------------------------------------------------------------------
+QMutex *RegistryMutex()
+{
+    static QMutex mutex;
+    return &mutex;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+std::vector<std::unique_ptr<TraceBuffer>> &Registry()
+{
+    static std::vector<std::unique_ptr<TraceBuffer>> registry;
+    return registry;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TraceBuffer *ThreadBuffer()
+{
+    static thread_local TraceBuffer *buffer = nullptr;
+    if (buffer == nullptr)
+    {
+        const QCoreApplication *app = QCoreApplication::instance();
+        const bool mainThread = app != nullptr && QThread::currentThread() == app->thread();
+
+        QMutexLocker locker(RegistryMutex());
+        std::vector<std::unique_ptr<TraceBuffer>> &registry = Registry();
+        const int threadId = static_cast<int>(registry.size()) + 1;
+        const QByteArray name = mainThread ? QByteArrayLiteral("Main thread")
+                                           : QByteArrayLiteral("Worker thread ") + QByteArray::number(threadId);
+        registry.emplace_back(new TraceBuffer(threadId, name));
+        buffer = registry.back().get();
+    }
+    return buffer;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void WriteMetadata(QByteArray &json, qint64 pid, int tid, const char *name, const QByteArray &value)
+{
+    json += "{\"ph\":\"M\",\"pid\":" + QByteArray::number(pid) + ",\"tid\":" + QByteArray::number(tid)
+            + ",\"name\":\"" + name + "\",\"args\":{\"name\":\"" + value + "\"}},\n";
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void WriteEvent(QByteArray &json, qint64 pid, int tid, const TraceEvent &event)
+{
+    // Chrome trace format expects microseconds
+    json += "{\"ph\":\"X\",\"pid\":" + QByteArray::number(pid) + ",\"tid\":" + QByteArray::number(tid)
+            + ",\"name\":\"" + event.name + "\",\"cat\":\"" + event.category
+            + "\",\"ts\":" + QByteArray::number(event.start / 1000.0, 'f', 3)
+            + ",\"dur\":" + QByteArray::number(event.duration / 1000.0, 'f', 3) + "},\n";
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Start begins recording of trace events.
+ */
+void VTrace::Start()
+{
+    if (recording.load())
+    {
+        return;
+    }
+
+    traceClock.start();
+    recording.store(true, std::memory_order_release);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VTrace::IsEnabled()
+{
+    return recording.load(std::memory_order_acquire);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qint64 VTrace::Now()
+{
+    return traceClock.nsecsElapsed();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTrace::AddEvent(const char *name, const char *category, qint64 start, qint64 duration)
+{
+    ThreadBuffer()->Append({name, category, start, duration});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Save stops recording and writes all collected events in Chrome trace format.
+ * @param fileName output file.
+ * @return true if file was written.
+ */
+bool VTrace::Save(const QString &fileName)
+{
+    recording.store(false);
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    QByteArray json;
+    json.reserve(1024 * 1024);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    WriteMetadata(json, pid, 0, "process_name", QCoreApplication::applicationName().toUtf8());
+
+    {
+        QMutexLocker locker(RegistryMutex());
+        const std::vector<std::unique_ptr<TraceBuffer>> &registry = Registry();
+        for (const std::unique_ptr<TraceBuffer> &buffer : registry)
+        {
+            WriteMetadata(json, pid, buffer->threadId, "thread_name", buffer->threadName);
+
+            const TraceChunk *chunk = buffer->head;
+            while (chunk != nullptr)
+            {
+                const int count = chunk->count.load(std::memory_order_acquire);
+                for (int i = 0; i < count; ++i)
+                {
+                    WriteEvent(json, pid, buffer->threadId, chunk->events[i]);
+                }
+                chunk = chunk->next.load(std::memory_order_acquire);
+            }
+        }
+    }
+
+    json.chop(2); // last ",\n"
+    json += "\n]}\n";
+
+    QFile file(fileName);
+    if (not file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+    return file.write(json) == json.size();
+}
@@ -0,0 +1,89 @@
+/***************************************************************************
+ **  @file   vtrace.h
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#ifndef VTRACE_H
+#define VTRACE_H
+
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * @brief Lightweight tracing of hot paths.
+ *
+ * Scopes marked with V_TRACE_SCOPE record complete events ("ph":"X") in per-thread buffers while recording is
+ * enabled. Writing an event never takes a lock: each thread appends to its own chunked buffer and publishes the number
+ * of written events atomically, so the buffers can be collected at any time. VTrace::Save() writes the collected events
+ * in Chrome trace format that can be opened in Perfetto or chrome://tracing.
+ *
+ * Define V_NO_TRACE (qmake CONFIG+=noTrace) to compile the instrumentation out. Without recording a scope costs one
+ * atomic load.
+ *
+ * Names and categories must be string literals, buffers keep only pointers to them.
+ */
+namespace VTrace
+{
+void Start();
+bool IsEnabled();
+bool Save(const QString &fileName);
+
+qint64 Now(); // nanoseconds since Start()
+void AddEvent(const char *name, const char *category, qint64 start, qint64 duration);
+}
+
+class VTraceScope
+{
+public:
+    VTraceScope(const char *name, const char *category)
+        : m_name(name),
+          m_category(category),
+          m_start(VTrace::IsEnabled() ? VTrace::Now() : -1)
+    {}
+
+    ~VTraceScope()
+    {
+        if (m_start >= 0)
+        {
+            VTrace::AddEvent(m_name, m_category, m_start, VTrace::Now() - m_start);
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(VTraceScope)
+
+    const char *m_name;
+    const char *m_category;
+    const qint64 m_start;
+};
+
+#define V_TRACE_CONCAT_IMPL(a, b) a##b
+#define V_TRACE_CONCAT(a, b) V_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef V_NO_TRACE
+#   define V_TRACE_SCOPE(name, category)
+#else
+#   define V_TRACE_SCOPE(name, category) \
+        const VTraceScope V_TRACE_CONCAT(vTraceScope, __LINE__)(name, category)
+#endif
+
+#endif // VTRACE_H
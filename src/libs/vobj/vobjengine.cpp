@@ -285,10 +285,12 @@ QPaintEngine::Type VObjEngine::type() const
 //---------------------------------------------------------------------------------------------------------------------
 void VObjEngine::drawPoints(const QPointF *points, int pointCount)
 {
+    // Map to range [-1, 1], y axis points up
+    const qreal half = qFloor(size.width()/2.0);
     for (int i = 0; i < pointCount; ++i)
     {
-        qreal x = ((points[i].x() - 0)/qFloor(size.width()/2.0)) - 1.0;
-        qreal y = (((points[i].y() - 0)/qFloor(size.width()/2.0)) - 1.0)*-1;
+        const qreal x = (points[i].x()/half) - 1.0;
+        const qreal y = ((points[i].y()/half) - 1.0)*-1;
 
         *stream << "v" << " " << QString::number(x, 'f', 6 ) << " " << QString::number(y, 'f', 6 ) << " "
 		     << "0.000000\n";
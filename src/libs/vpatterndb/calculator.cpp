@@ -57,6 +57,7 @@
 #include <QStringList>
 
 #include "../vmisc/def.h"
+#include "../vmisc/vtrace.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "variables/vinternalvariable.h"
 #include <QSharedPointer>
@@ -95,6 +96,7 @@ Calculator::Calculator()
  */
 qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable>> *vars, const QString &formula)
 {
+    V_TRACE_SCOPE("Calculator::EvalFormula", "formula");
     // Parser doesn't know any variable on this stage. So, we just use variable factory that for each unknown variable
     // set value to 0.
     SetVarFactory(AddVariable, this);
@@ -105,19 +107,7 @@ qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVaria
     qreal result = 0;
     result = Eval();
 
-    QMap<int, QString> tokens = this->GetTokens();
-
-    // Remove "-" from tokens list if exist. If don't do that unary minus operation will broken.
-    RemoveAll(tokens, QStringLiteral("-"));
-
-    for (int i = 0; i < builInFunctions.size(); ++i)
-    {
-        if (tokens.isEmpty())
-        {
-            break;
-        }
-        RemoveAll(tokens, builInFunctions.at(i));
-    }
+    const QMap<int, QString> tokens = FindVariables();
 
     if (tokens.isEmpty())
     {
@@ -164,3 +154,95 @@ void Calculator::InitVariables(const QHash<QString, QSharedPointer<VInternalVari
         ++i;
     }
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief EvalFormulaBulk calculate formula for a whole set of variable values at once.
+ *
+ * Expression is compiled only once, after that the parser runs its bytecode for each set of values. Used to build
+ * grading tables, where each measurement has own value for each size and height.
+ *
+ * @param vars list of variables. Variable that has no column keeps the same value for all sets.
+ * @param formula string of formula.
+ * @param columns values of variables for each set. Each column must have at least @a count values.
+ * @param count number of sets.
+ * @return value of formula for each set.
+ */
+QVector<qreal> Calculator::EvalFormulaBulk(const QHash<QString, QSharedPointer<VInternalVariable> > *vars,
+                                           const QString &formula, const QHash<QString, QVector<qreal> > &columns,
+                                           int count)
+{
+    V_TRACE_SCOPE("Calculator::EvalFormulaBulk", "formula");
+    QVector<qreal> results(qMax(count, 0), 0);
+    if (results.isEmpty())
+    {
+        return results;
+    }
+
+    ClearVar();
+    SetVarFactory(AddVariable, this);
+    SetSepForEval();//Reset separators options
+
+    SetExpr(formula);
+    const qreal single = Eval();
+
+    const QMap<int, QString> tokens = FindVariables();
+
+    if (tokens.isEmpty())
+    {
+        results.fill(single);
+        return results; // We have found only numbers in expression.
+    }
+
+    // Bulk mode reads a variable by its address plus the number of set, so each variable needs own array of values.
+    QVector<QVector<qreal> > storage;
+    storage.reserve(tokens.size());
+
+    QMap<int, QString>::const_iterator i = tokens.constBegin();
+    while (i != tokens.constEnd())
+    {
+        if (columns.contains(i.value()) && columns.value(i.value()).size() >= count)
+        {
+            storage.append(columns.value(i.value()));
+        }
+        else if (vars->contains(i.value()))
+        {
+            storage.append(QVector<qreal>(count, *vars->value(i.value())->GetValue()));
+        }
+        else
+        {
+            throw qmu::QmuParserError (qmu::ecUNASSIGNABLE_TOKEN, i.value(), formula, i.key());
+        }
+
+        DefineVar(i.value(), storage.last().data());
+        ++i;
+    }
+
+    Eval(results.data(), count);
+    return results;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FindVariables return tokens of the current expression that are not built-in functions.
+ *
+ * After successful EvalFormula these are exactly the variables the result depends on.
+ */
+QMap<int, QString> Calculator::FindVariables()
+{
+    QMap<int, QString> tokens = this->GetTokens();
+
+    // Remove "-" from tokens list if exist. If don't do that unary minus operation will broken.
+    RemoveAll(tokens, QStringLiteral("-"));
+
+    for (int i = 0; i < builInFunctions.size(); ++i)
+    {
+        if (tokens.isEmpty())
+        {
+            break;
+        }
+        RemoveAll(tokens, builInFunctions.at(i));
+    }
+
+    return tokens;
+}
@@ -56,6 +56,7 @@
 #include <QHash>
 #include <QMap>
 #include <QString>
+#include <QVector>
 #include <QtGlobal>
 
 #include "../qmuparser/qmuformulabase.h"
@@ -87,6 +88,9 @@ class Calculator:public qmu::QmuFormulaBase
     virtual ~Calculator() Q_DECL_EQ_DEFAULT;
 
     qreal EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QString &formula);
+    QVector<qreal> EvalFormulaBulk(const QHash<QString, QSharedPointer<VInternalVariable> > *vars,
+                                   const QString &formula, const QHash<QString, QVector<qreal> > &columns, int count);
+    QMap<int, QString> FindVariables();
 private:
     Q_DISABLE_COPY(Calculator)
 
@@ -327,6 +327,54 @@ qreal *MeasurementVariable::GetValue()
     return VInternalVariable::GetValue();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief gradedValues calculate value of the measurement for each pair of size and height.
+ *
+ * The same gradation formula as CalcValue(), but for the whole grid in one pass. Measurement from an individual file
+ * has the same value everywhere.
+ *
+ * @param sizes sizes in current units.
+ * @param heights heights in current units.
+ * @return value for each pair.
+ */
+QVector<qreal> MeasurementVariable::gradedValues(const QVector<qreal> &sizes, const QVector<qreal> &heights) const
+{
+    const int count = qMin(sizes.size(), heights.size());
+    QVector<qreal> values(count, 0);
+
+    if (d->currentUnit == nullptr || d->currentSize == nullptr || d->currentHeight == nullptr)
+    {
+        values.fill(VInternalVariable::GetValue());
+        return values;
+    }
+
+    if (*d->currentUnit == Unit::Inch)
+    {
+        qWarning("Gradation doesn't support inches");
+        return values;
+    }
+
+    const qreal sizeIncrement = UnitConvertor(2.0, Unit::Cm, *d->currentUnit);
+    const qreal heightIncrement = UnitConvertor(6.0, Unit::Cm, *d->currentUnit);
+
+    const qreal base = d->base;
+    const qreal baseSize = d->baseSize;
+    const qreal baseHeight = d->baseHeight;
+    const qreal ksize = d->ksize;
+    const qreal kheight = d->kheight;
+
+    const qreal *s = sizes.constData();
+    const qreal *h = heights.constData();
+    qreal *v = values.data();
+    for (int i = 0; i < count; ++i)
+    {
+        v[i] = base + (s[i] - baseSize) / sizeIncrement * ksize + (h[i] - baseHeight) / heightIncrement * kheight;
+    }
+
+    return values;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VContainer *MeasurementVariable::GetData()
 {
@@ -62,6 +62,7 @@
 #include <QString>
 #include <QStringList>
 #include <QTypeInfo>
+#include <QVector>
 #include <QtGlobal>
 
 #include "../vmisc/def.h"
@@ -114,6 +115,8 @@ class MeasurementVariable :public VVariable
     virtual qreal      GetValue() const Q_DECL_OVERRIDE;
     virtual qreal     *GetValue() Q_DECL_OVERRIDE;
 
+    QVector<qreal>     gradedValues(const QVector<qreal> &sizes, const QVector<qreal> &heights) const;
+
     VContainer        *GetData();
 
     void               setSize(qreal *size);
@@ -53,10 +53,13 @@
 #include "vcontainer.h"
 
 #include <limits.h>
+#include <QScopedPointer>
 #include <QVector>
 #include <QtDebug>
+#include <QtNumeric>
 
 #include "../ifc/exception/vexception.h"
+#include "../qmuparser/qmuparsererror.h"
 #include "../vgeometry/vabstractcubicbezierpath.h"
 #include "../vgeometry/vabstractcurve.h"
 #include "../vgeometry/vgeometrydef.h"
@@ -77,6 +80,7 @@
 #include "variables/vlinelength.h"
 #include "variables/measurement_variable.h"
 #include "variables/vvariable.h"
+#include "calculator.h"
 #include "vtranslatevars.h"
 
 QT_WARNING_PUSH
@@ -581,6 +585,59 @@ const QMap<QString, QSharedPointer<VCurveAngle> > VContainer::curveAnglesData()
     return DataVar<VCurveAngle>(VarType::CurveAngle);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief gradingTable calculate values of all measurements and increments for each pair of size and height.
+ *
+ * Each increment formula is compiled once and evaluated for the whole grid in bulk mode. Increments are evaluated in
+ * the table order, so an increment can use values of previous ones. An increment with a wrong formula gets NaN.
+ *
+ * @param sizes sizes in pattern units.
+ * @param heights heights in pattern units, one for each size.
+ * @return column of values for each internal variable name.
+ */
+QHash<QString, QVector<qreal> > VContainer::gradingTable(const QVector<qreal> &sizes,
+                                                         const QVector<qreal> &heights) const
+{
+    const int count = qMin(sizes.size(), heights.size());
+
+    QHash<QString, QVector<qreal> > table;
+    QMap<quint32, QSharedPointer<VIncrement> > increments;
+
+    QHash<QString, QSharedPointer<VInternalVariable> >::const_iterator i;
+    for (i = d->variables.constBegin(); i != d->variables.constEnd(); ++i)
+    {
+        if (i.value()->GetType() == VarType::Measurement)
+        {
+            table.insert(i.key(), qSharedPointerDynamicCast<MeasurementVariable>(i.value())->gradedValues(sizes,
+                                                                                                          heights));
+        }
+        else if (i.value()->GetType() == VarType::Increment)
+        {
+            const QSharedPointer<VIncrement> increment = qSharedPointerDynamicCast<VIncrement>(i.value());
+            increments.insert(increment->getIndex(), increment);
+        }
+    }
+
+    QScopedPointer<Calculator> cal(new Calculator());
+    QMap<quint32, QSharedPointer<VIncrement> >::const_iterator incr;
+    for (incr = increments.constBegin(); incr != increments.constEnd(); ++incr)
+    {
+        try
+        {
+            table.insert(incr.value()->GetName(),
+                         cal->EvalFormulaBulk(&d->variables, incr.value()->GetFormula(), table, count));
+        }
+        catch (qmu::QmuParserError &error)
+        {
+            Q_UNUSED(error)
+            table.insert(incr.value()->GetName(), QVector<qreal>(count, qQNaN()));
+        }
+    }
+
+    return table;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VContainer::IsUnique(const QString &name)
 {
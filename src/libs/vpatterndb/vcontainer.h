@@ -64,6 +64,7 @@
 #include <QString>
 #include <QStringList>
 #include <QTypeInfo>
+#include <QVector>
 #include <QtGlobal>
 #include <new>
 
@@ -219,6 +220,8 @@ class VContainer
     const QMap<QString, QSharedPointer<VArcRadius> >    arcRadiusesData() const;
     const QMap<QString, QSharedPointer<VCurveAngle> >   curveAnglesData() const;
 
+    QHash<QString, QVector<qreal> > gradingTable(const QVector<qreal> &sizes, const QVector<qreal> &heights) const;
+
     static bool        IsUnique(const QString &name);
     static QStringList AllUniqueNames();
 
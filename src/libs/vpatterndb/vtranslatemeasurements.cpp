@@ -54,6 +54,8 @@
 
 #include "vtranslatemeasurements.h"
 
+#include <QMutexLocker>
+
 #include "../qmuparser/qmutranslation.h"
 #include "measurements_def.h"
 
@@ -64,9 +66,9 @@ VTranslateMeasurements::VTranslateMeasurements()
     , m_descriptions(QMap<QString, qmu::QmuTranslation>())
     , m_numbers(QMap<QString, QString>())
     , m_formulas(QMap<QString, QString>())
-{
-    InitMeasurements();
-}
+    , m_initialized(0)
+    , m_initMutex()
+{}
 
 //---------------------------------------------------------------------------------------------------------------------
 VTranslateMeasurements::~VTranslateMeasurements()
@@ -84,6 +86,8 @@ VTranslateMeasurements::~VTranslateMeasurements()
 bool VTranslateMeasurements::MeasurementsFromUser(QString &newFormula, int position, const QString &token,
                                                   int &bias) const
 {
+    InitOnDemand();
+
     QMap<QString, qmu::QmuTranslation>::const_iterator i = m_measurements.constBegin();
     while (i != m_measurements.constEnd())
     {
@@ -101,6 +105,8 @@ bool VTranslateMeasurements::MeasurementsFromUser(QString &newFormula, int posit
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::MToUser(const QString &measurement) const
 {
+    InitOnDemand();
+
     if (m_measurements.contains(measurement))
     {
         return m_measurements.value(measurement).translate();
@@ -114,6 +120,8 @@ QString VTranslateMeasurements::MToUser(const QString &measurement) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::MNumber(const QString &measurement) const
 {
+    InitOnDemand();
+
     if (m_numbers.contains(measurement))
     {
         return m_numbers.value(measurement);
@@ -127,12 +135,16 @@ QString VTranslateMeasurements::MNumber(const QString &measurement) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::MFormula(const QString &measurement) const
 {
+    InitOnDemand();
+
     return m_formulas.value(measurement);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::guiText(const QString &measurement) const
 {
+    InitOnDemand();
+
     if (m_guiTexts.contains(measurement))
     {
         return m_guiTexts.value(measurement).translate();
@@ -146,6 +158,8 @@ QString VTranslateMeasurements::guiText(const QString &measurement) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::Description(const QString &measurement) const
 {
+    InitOnDemand();
+
     if (m_descriptions.contains(measurement))
     {
         return m_descriptions.value(measurement).translate();
@@ -157,13 +171,38 @@ QString VTranslateMeasurements::Description(const QString &measurement) const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Retranslate update translations after the language was changed.
+ *
+ * Tables store only source strings. QmuTranslation::translate() resolves them against the installed translators on
+ * each lookup, so the tables themselves don't need to be rebuilt.
+ */
 void VTranslateMeasurements::Retranslate()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief InitOnDemand fill the translation tables on first use.
+ *
+ * Building the tables is expensive, and many runs (console mode, SeamlyMe without a file) never need most of them.
+ * Safe to call from several threads.
+ */
+void VTranslateMeasurements::InitOnDemand() const
+{
+    if (m_initialized.loadAcquire() == 0)
+    {
+        QMutexLocker locker(&m_initMutex);
+        if (m_initialized.load() == 0)
+        {
+            const_cast<VTranslateMeasurements *>(this)->InitTables();
+            m_initialized.storeRelease(1);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTranslateMeasurements::InitTables()
 {
-    m_measurements.clear();
-    m_guiTexts.clear();
-    m_descriptions.clear();
-    m_numbers.clear();
-    m_formulas.clear();
     InitMeasurements();
 }
 
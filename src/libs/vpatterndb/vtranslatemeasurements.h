@@ -55,7 +55,9 @@
 #ifndef VTRANSLATEMEASUREMENTS_H
 #define VTRANSLATEMEASUREMENTS_H
 
+#include <QAtomicInt>
 #include <QMap>
+#include <QMutex>
 #include <QString>
 #include <QtGlobal>
 
@@ -80,8 +82,13 @@ class VTranslateMeasurements
 protected:
     QMap<QString, qmu::QmuTranslation> m_measurements;
 
+    void InitOnDemand() const;
+    virtual void InitTables();
+
 private:
     Q_DISABLE_COPY(VTranslateMeasurements)
+    mutable QAtomicInt                 m_initialized;
+    mutable QMutex                     m_initMutex;
     QMap<QString, qmu::QmuTranslation> m_guiTexts;
     QMap<QString, qmu::QmuTranslation> m_descriptions;
     QMap<QString, QString>             m_numbers;
@@ -56,6 +56,7 @@
 #include <QLocale>
 #include <QMap>
 #include <QMessageLogger>
+#include <QMutexLocker>
 #include <QString>
 #include <QtDebug>
 
@@ -69,6 +70,12 @@
 #include "../qmuparser/qmutranslation.h"
 #include "../vpatterndb/vtranslatevars.h"
 
+namespace
+{
+// Max number of translated formulas kept for each direction. Enough for the biggest measurement tables.
+const int formulaCacheSize = 2000;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VTranslateVars::VTranslateVars()
     : VTranslateMeasurements()
@@ -80,7 +87,22 @@ VTranslateVars::VTranslateVars()
     , postfixOperators(QMap<QString, qmu::QmuTranslation>())
     , placeholders(QMap<QString, qmu::QmuTranslation>())
     , stDescriptions(QMap<QString, qmu::QmuTranslation>())
+    , m_toUserCache(formulaCacheSize)
+    , m_fromUserCache(formulaCacheSize)
+    , m_cacheMutex()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+VTranslateVars::~VTranslateVars()
+{}
+
+#define translate(context, source, disambiguation) qmu::QmuTranslation::translate((context), (source), (disambiguation))
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTranslateVars::InitTables()
 {
+    VTranslateMeasurements::InitTables();
+
     InitPatternMakingSystems();
     InitVariables();
     InitFunctions();
@@ -88,12 +110,6 @@ VTranslateVars::VTranslateVars()
     InitPlaceholder();
 }
 
-//---------------------------------------------------------------------------------------------------------------------
-VTranslateVars::~VTranslateVars()
-{}
-
-#define translate(context, source, disambiguation) qmu::QmuTranslation::translate((context), (source), (disambiguation))
-
 //---------------------------------------------------------------------------------------------------------------------
 void VTranslateVars::InitPatternMakingSystems()
 {
@@ -520,30 +536,6 @@ void VTranslateVars::InitSystem(const QString &code, const qmu::QmuTranslation &
     PMSystemBooks.insert(code, book);
 }
 
-//---------------------------------------------------------------------------------------------------------------------
-/**
- * @brief CorrectionsPositions correct position tokens in expression after token translation.
- *
- * Because translated string can have different length compare to original need make correction after each translation.
- * If bias = 0 correction will not happens.
- *
- * @param position position currecnt token in expression
- * @param bias difference between original token length and translated
- * @param tokens all tokens
- * @param numbers all numbers
- */
-void VTranslateVars::CorrectionsPositions(int position, int bias, QMap<int, QString> &tokens,
-                                          QMap<int, QString> &numbers) const
-{
-    if (bias == 0)
-    {
-        return;// Nothing to correct;
-    }
-
-    BiasTokens(position, bias, tokens);
-    BiasTokens(position, bias, numbers);
-}
-
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief BiasTokens change position for each token that have position more then "position".
@@ -583,6 +575,8 @@ void VTranslateVars::BiasTokens(int position, int bias, QMap<int, QString> &toke
  */
 bool VTranslateVars::VariablesFromUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
+    InitOnDemand();
+
     const QString currentLengthTr = variables.value(currentLength).translate();
     const QString currentSeamAllowanceTr = variables.value(currentSeamAllowance).translate();
 
@@ -622,6 +616,8 @@ bool VTranslateVars::VariablesFromUser(QString &newFormula, int position, const
  */
 bool VTranslateVars::PostfixOperatorsFromUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
+    InitOnDemand();
+
     QMap<QString, qmu::QmuTranslation>::const_iterator i = postfixOperators.constBegin();
     while (i != postfixOperators.constEnd())
     {
@@ -647,6 +643,8 @@ bool VTranslateVars::PostfixOperatorsFromUser(QString &newFormula, int position,
  */
 bool VTranslateVars::FunctionsFromUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
+    InitOnDemand();
+
     QMap<QString, qmu::QmuTranslation>::const_iterator i = functions.constBegin();
     while (i != functions.constEnd())
     {
@@ -672,6 +670,8 @@ bool VTranslateVars::FunctionsFromUser(QString &newFormula, int position, const
  */
 bool VTranslateVars::VariablesToUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
+    InitOnDemand();
+
     QMap<QString, qmu::QmuTranslation>::const_iterator i = variables.constBegin();
     while (i != variables.constEnd())
     {
@@ -713,6 +713,8 @@ QString VTranslateVars::InternalVarToUser(const QString &var) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PlaceholderToUser(const QString &var) const
 {
+    InitOnDemand();
+
     if (placeholders.contains(var))
     {
         return placeholders.value(var).translate();
@@ -724,6 +726,8 @@ QString VTranslateVars::PlaceholderToUser(const QString &var) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PlaceholderToUserText(QString text) const
 {
+    InitOnDemand();
+
     QChar per('%');
     auto i = placeholders.constBegin();
     while (i != placeholders.constEnd())
@@ -743,6 +747,8 @@ QString VTranslateVars::PlaceholderToUserText(QString text) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PlaceholderFromUserText(QString text) const
 {
+    InitOnDemand();
+
     QChar per('%');
     auto i = placeholders.constBegin();
     while (i != placeholders.constEnd())
@@ -762,6 +768,8 @@ QString VTranslateVars::PlaceholderFromUserText(QString text) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::VarToUser(const QString &var) const
 {
+    InitOnDemand();
+
     if (m_measurements.contains(var))
     {
         return m_measurements.value(var).translate();
@@ -810,18 +818,24 @@ QString VTranslateVars::VarFromUser(const QString &var) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PMSystemName(const QString &code) const
 {
+    InitOnDemand();
+
     return PMSystemNames.value(code).translate();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PMSystemAuthor(const QString &code) const
 {
+    InitOnDemand();
+
     return PMSystemAuthors.value(code).translate();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PMSystemBook(const QString &code) const
 {
+    InitOnDemand();
+
     return PMSystemBooks.value(code).translate();
 }
 
@@ -829,6 +843,8 @@ QString VTranslateVars::PMSystemBook(const QString &code) const
 // cppcheck-suppress unusedFunction
 QString VTranslateVars::PostfixOperator(const QString &name) const
 {
+    InitOnDemand();
+
     return postfixOperators.value(name).translate();
 }
 
@@ -846,97 +862,67 @@ QString VTranslateVars::FormulaFromUser(const QString &formula, bool osSeparator
     {
         return formula;
     }
-    QString newFormula = formula;// Local copy for making changes
-
-    QScopedPointer<qmu::QmuTokenParser> cal(new qmu::QmuTokenParser(formula, osSeparator));// Eval formula
-    QMap<int, QString> tokens = cal->GetTokens();// Tokens (variables, measurements)
-    QMap<int, QString> numbers = cal->GetNumbers();// All numbers in expression for changing decimal separator
-    delete cal.take();
 
-    QList<int> tKeys = tokens.keys();// Take all tokens positions
-    QList<QString> tValues = tokens.values();
-    for (int i = 0; i < tKeys.size(); ++i)
+    const QString key = CacheKey(formula, osSeparator);
     {
-        int bias = 0;
-        if (MeasurementsFromUser(newFormula, tKeys.at(i), tValues.at(i), bias))
+        QMutexLocker locker(&m_cacheMutex);
+        if (const QString *cached = m_fromUserCache.object(key))
         {
-            if (bias != 0)
-            {// Translated token has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
-                tKeys = tokens.keys();
-                tValues = tokens.values();
-            }
-            continue;
+            return *cached;
         }
+    }
 
-        if (VariablesFromUser(newFormula, tKeys.at(i), tValues.at(i), bias))
-        {
-            if (bias != 0)
-            {// Translated token has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
-                tKeys = tokens.keys();
-                tValues = tokens.values();
-            }
-            continue;
-        }
+    InitOnDemand();
 
-        if (PostfixOperatorsFromUser(newFormula, tKeys.at(i), tValues.at(i), bias))
-        {
-            if (bias != 0)
-            {// Translated token has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
-                tKeys = tokens.keys();
-                tValues = tokens.values();
-            }
-            continue;
-        }
+    QScopedPointer<qmu::QmuTokenParser> cal(new qmu::QmuTokenParser(formula, osSeparator));// Eval formula
+    const QMap<int, QString> tokens = cal->GetTokens();// Tokens (variables, measurements)
+    const QMap<int, QString> numbers = cal->GetNumbers();// All numbers in expression for changing decimal separator
+    delete cal.take();
 
-        if (FunctionsFromUser(newFormula, tKeys.at(i), tValues.at(i), bias))
+    QMap<int, QString> spans;// Replacements for tokens, each one covers the whole original token
+
+    QMap<int, QString>::const_iterator i = tokens.constBegin();
+    while (i != tokens.constEnd())
+    {
+        const QString &token = i.value();
+        QString newToken = token;
+        int bias = 0;
+        if (MeasurementsFromUser(newToken, 0, token, bias) || VariablesFromUser(newToken, 0, token, bias) ||
+            PostfixOperatorsFromUser(newToken, 0, token, bias) || FunctionsFromUser(newToken, 0, token, bias))
         {
-            if (bias != 0)
-            {// Translated token has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
-                tKeys = tokens.keys();
-                tValues = tokens.values();
-            }
-            continue;
+            spans.insert(i.key(), newToken);
         }
-
-        if (tValues.at(i) == QLocale().negativeSign())
+        else if (token == QLocale().negativeSign())
         {// unary minus
-            newFormula.replace(tKeys.at(i), 1, '-');
+            spans.insert(i.key(), QString("-"));
         }
+        ++i;
     }
 
     QLocale loc = QLocale(); // User locale
     if (loc != QLocale::c() && osSeparator)
     {// User want use Os separator
-        QList<int> nKeys = numbers.keys();// Positions for all numbers in expression
-        QList<QString> nValues = numbers.values();
-        for (int i = 0; i < nKeys.size(); ++i)
+        QMap<int, QString>::const_iterator n = numbers.constBegin();
+        while (n != numbers.constEnd())
         {
-            loc = QLocale();// From system locale
             bool ok = false;
-            const qreal d = loc.toDouble(nValues.at(i), &ok);
+            const qreal d = loc.toDouble(n.value(), &ok);// From system locale
             if (ok == false)
             {
-                qDebug() << "Can't convert to double token"<<nValues.at(i);
-                continue;//Leave with out translation
+                qDebug() << "Can't convert to double token"<<n.value();
             }
-
-            loc = QLocale::c();// To internal locale
-            const QString dStr = loc.toString(d);// Internal look for number
-            newFormula.replace(nKeys.at(i), nValues.at(i).length(), dStr);
-            const int bias = nValues.at(i).length() - dStr.length();
-            if (bias != 0)
-            {// Translated number has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(nKeys.at(i), bias, tokens, numbers);
-                nKeys = numbers.keys();
-                nValues = numbers.values();
+            else
+            {
+                spans.insert(n.key(), QLocale::c().toString(d));// To internal locale
             }
+            ++n;
         }
     }
 
+    const QString newFormula = ReplaceSpans(formula, spans, tokens, numbers);
+
+    QMutexLocker locker(&m_cacheMutex);
+    m_fromUserCache.insert(key, new QString(newFormula));
     return newFormula;
 }
 
@@ -968,7 +954,16 @@ QString VTranslateVars::FormulaToUser(const QString &formula, bool osSeparator)
         return formula;
     }
 
-    QString newFormula = formula;// Local copy for making changes
+    const QString key = CacheKey(formula, osSeparator);
+    {
+        QMutexLocker locker(&m_cacheMutex);
+        if (const QString *cached = m_toUserCache.object(key))
+        {
+            return *cached;
+        }
+    }
+
+    InitOnDemand();
 
     QMap<int, QString> tokens;
     QMap<int, QString> numbers;
@@ -985,124 +980,148 @@ QString VTranslateVars::FormulaToUser(const QString &formula, bool osSeparator)
                    << "Message:     " << error.GetMsg()  << "\n"
                    << "Expression:  " << error.GetExpr() << "\n"
                    << "--------------------------------------";
-        return newFormula;
+        return formula;
     }
 
-    QList<int> tKeys = tokens.keys();
-    QList<QString> tValues = tokens.values();
-    for (int i = 0; i < tKeys.size(); ++i)
+    QMap<int, QString> spans;// Replacements for tokens, each one covers the whole original token
+
+    QMap<int, QString>::const_iterator i = tokens.constBegin();
+    while (i != tokens.constEnd())
     {
-        if (m_measurements.contains(tValues.at(i)))
+        const QString &token = i.value();
+        if (m_measurements.contains(token))
         {
-            newFormula.replace(tKeys.at(i), tValues.at(i).length(), m_measurements.value(tValues.at(i)).translate());
-            int bias = tValues.at(i).length() - m_measurements.value(tValues.at(i)).translate().length();
-            if (bias != 0)
-            {// Translated token has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
-                tKeys = tokens.keys();
-                tValues = tokens.values();
-            }
-            continue;
+            spans.insert(i.key(), m_measurements.value(token).translate());
         }
-
-        if (functions.contains(tValues.at(i)))
+        else if (functions.contains(token))
         {
-            newFormula.replace(tKeys.at(i), tValues.at(i).length(), functions.value(tValues.at(i)).translate());
-            int bias = tValues.at(i).length() - functions.value(tValues.at(i)).translate().length();
-            if (bias != 0)
-            {// Translated token has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
-                tKeys = tokens.keys();
-                tValues = tokens.values();
-            }
-            continue;
+            spans.insert(i.key(), functions.value(token).translate());
         }
-
-        if (postfixOperators.contains(tValues.at(i)))
+        else if (postfixOperators.contains(token))
         {
-            newFormula.replace(tKeys.at(i), tValues.at(i).length(), postfixOperators.value(tValues.at(i)).translate());
-            int bias = tValues.at(i).length() - postfixOperators.value(tValues.at(i)).translate().length();
-            if (bias != 0)
-            {// Translated token has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
-                tKeys = tokens.keys();
-                tValues = tokens.values();
-            }
-            continue;
+            spans.insert(i.key(), postfixOperators.value(token).translate());
         }
-
-        int bias = 0;
-        if (VariablesToUser(newFormula, tKeys.at(i), tValues.at(i), bias))
+        else
         {
-            if (bias != 0)
-            {// Translated token has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
-                tKeys = tokens.keys();
-                tValues = tokens.values();
+            QString newToken = token;
+            int bias = 0;
+            if (VariablesToUser(newToken, 0, token, bias))
+            {
+                spans.insert(i.key(), newToken);
+            }
+            else if (token == QChar('-'))
+            {// unary minus
+                spans.insert(i.key(), QLocale().negativeSign());
             }
-            continue;
-        }
-
-        if (tValues.at(i) == QChar('-'))
-        {// unary minus
-            newFormula.replace(tKeys.at(i), 1, QLocale().negativeSign());
         }
+        ++i;
     }
 
-    QLocale loc = QLocale();// User locale
+    const QLocale loc = QLocale();// User locale
     if (loc != QLocale::C && osSeparator)
     {// User want use Os separator
-        QList<int> nKeys = numbers.keys();// Positions for all numbers in expression
-        QList<QString> nValues = numbers.values();
-        for (int i = 0; i < nKeys.size(); ++i)
+        QMap<int, QString>::const_iterator n = numbers.constBegin();
+        while (n != numbers.constEnd())
         {
-            loc = QLocale::c();// From pattern locale
             bool ok = false;
-            const qreal d = loc.toDouble(nValues.at(i), &ok);
+            const qreal d = QLocale::c().toDouble(n.value(), &ok);// From pattern locale
             if (ok == false)
             {
-                qDebug() << "Can't convert to double token"<<nValues.at(i);
-                continue;//Leave with out translation
+                qDebug() << "Can't convert to double token"<<n.value();
             }
-
-            loc = QLocale();// To user locale
-            QString dStr = loc.toString(d);// Number string in user locale
-            newFormula.replace(nKeys.at(i), nValues.at(i).length(), dStr);
-            const int bias = nValues.at(i).length() - dStr.length();
-            if (bias != 0)
-            {// Translated number has different length than original. Position next tokens need to be corrected.
-                CorrectionsPositions(nKeys.at(i), bias, tokens, numbers);
-                nKeys = numbers.keys();
-                nValues = numbers.values();
+            else
+            {
+                spans.insert(n.key(), loc.toString(d));// Number string in user locale
             }
+            ++n;
         }
     }
 
+    const QString newFormula = ReplaceSpans(formula, spans, tokens, numbers);
+
+    QMutexLocker locker(&m_cacheMutex);
+    m_toUserCache.insert(key, new QString(newFormula));
     return newFormula;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ClearFormulaCache forget all translated formulas.
+ *
+ * Call it when something the translation depends on was changed outside of the cache key, e.g. installed translators.
+ */
+void VTranslateVars::ClearFormulaCache() const
+{
+    QMutexLocker locker(&m_cacheMutex);
+    m_toUserCache.clear();
+    m_fromUserCache.clear();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VTranslateVars::Retranslate()
 {
     VTranslateMeasurements::Retranslate();
+    ClearFormulaCache();
+}
 
-    PMSystemNames.clear();
-    PMSystemAuthors.clear();
-    PMSystemBooks.clear();
-    variables.clear();
-    functions.clear();
-    postfixOperators.clear();
-    stDescriptions.clear();
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CacheKey make a key for the formula cache. Result of translation depends on the current locale and the
+ * separator option, so both are part of the key.
+ */
+QString VTranslateVars::CacheKey(const QString &formula, bool osSeparator)
+{
+    return QLocale().name() + (osSeparator ? QChar('1') : QChar('0')) + QChar('\n') + formula;
+}
 
-    InitPatternMakingSystems();
-    InitVariables();
-    InitFunctions();
-    InitPostfixOperators();
-    InitPlaceholder();
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReplaceSpans build translated expression in one pass.
+ *
+ * Positions of all tokens and numbers refer to the original expression, so there is no need to correct them after
+ * each replacement.
+ *
+ * @param formula original expression
+ * @param spans new text for a token or number that starts at the key position
+ * @param tokens all tokens
+ * @param numbers all numbers
+ * @return translated expression
+ */
+QString VTranslateVars::ReplaceSpans(const QString &formula, const QMap<int, QString> &spans,
+                                     const QMap<int, QString> &tokens, const QMap<int, QString> &numbers)
+{
+    if (spans.isEmpty())
+    {
+        return formula;
+    }
+
+    QString newFormula;
+    newFormula.reserve(formula.size() + formula.size() / 2);
+
+    int last = 0;
+    QMap<int, QString>::const_iterator i = spans.constBegin();
+    while (i != spans.constEnd())
+    {
+        const int position = i.key();
+        const int length = tokens.contains(position) ? tokens.value(position).length()
+                                                     : numbers.value(position).length();
+        if (position >= last)
+        {
+            newFormula.append(formula.midRef(last, position - last));
+            newFormula.append(i.value());
+            last = position + length;
+        }
+        ++i;
+    }
+    newFormula.append(formula.midRef(last));
+
+    return newFormula;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QMap<QString, qmu::QmuTranslation> VTranslateVars::getFunctions() const
 {
+    InitOnDemand();
+
     return functions;
 }
@@ -53,6 +53,8 @@
 #define VTRANSLATEVARS_H
 
 #include <qcompilerdetection.h>
+#include <QCache>
+#include <QMutex>
 #include <QtGlobal>
 
 #include "vtranslatemeasurements.h"
@@ -87,12 +89,17 @@ class VTranslateVars : public VTranslateMeasurements
     static QString TryFormulaFromUser(const QString &formula, bool osSeparator);
     QString FormulaToUser(const QString &formula, bool osSeparator) const;
 
+    void ClearFormulaCache() const;
+
     virtual void Retranslate() Q_DECL_OVERRIDE;
 
     QMap<QString, qmu::QmuTranslation> getFunctions() const;
 
     static void BiasTokens(int position, int bias, QMap<int, QString> &tokens);
 
+protected:
+    virtual void InitTables() Q_DECL_OVERRIDE;
+
 private:
     Q_DISABLE_COPY(VTranslateVars)
     QMap<QString, qmu::QmuTranslation> PMSystemNames;
@@ -104,6 +111,10 @@ class VTranslateVars : public VTranslateMeasurements
     QMap<QString, qmu::QmuTranslation> placeholders;
     QMap<QString, qmu::QmuTranslation> stDescriptions;
 
+    mutable QCache<QString, QString>   m_toUserCache;
+    mutable QCache<QString, QString>   m_fromUserCache;
+    mutable QMutex                     m_cacheMutex;
+
     void InitPatternMakingSystems();
     void InitVariables();
     void InitFunctions();
@@ -113,8 +124,9 @@ class VTranslateVars : public VTranslateMeasurements
     void InitSystem(const QString &code, const qmu::QmuTranslation &name, const qmu::QmuTranslation &author,
                     const qmu::QmuTranslation &book);
 
-    void CorrectionsPositions(int position, int bias, QMap<int, QString> &tokens, QMap<int, QString> &numbers) const;
-
+    static QString CacheKey(const QString &formula, bool osSeparator);
+    static QString ReplaceSpans(const QString &formula, const QMap<int, QString> &spans,
+                                const QMap<int, QString> &tokens, const QMap<int, QString> &numbers);
 };
 
 #endif // VTRANSLATEVARS_H
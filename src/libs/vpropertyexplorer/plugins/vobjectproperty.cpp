@@ -116,6 +116,17 @@ void VPE::VObjectProperty::setObjectsList(const QMap<QString, quint32> &objects)
         m_indexList.append(i.key());
         ++i;
     }
+
+    // The property can be rebound to another object while its editor is shown
+    QComboBox *objEditor = qobject_cast<QComboBox *>(VProperty::d_ptr->editor);
+    if (objEditor != nullptr)
+    {
+        objEditor->blockSignals(true);
+        objEditor->clear();
+        fillListItems(objEditor, m_objects);
+        objEditor->setCurrentIndex(VProperty::d_ptr->VariantValue.toInt());
+        objEditor->blockSignals(false);
+    }
 }
 
 //! Get the settings. This function has to be implemented in a subclass in order to have an effect
@@ -72,6 +72,7 @@
 #include "../vgeometry/vabstractcubicbezier.h"
 #include "../vgeometry/vabstractcubicbezierpath.h"
 #include "../vgeometry/vabstractcurve.h"
+#include "../vgeometry/vcurveintersection.h"
 #include "../vgeometry/varc.h"
 #include "../vgeometry/vellipticalarc.h"
 #include "../vgeometry/vgobject.h"
@@ -234,13 +235,16 @@ bool VToolCurveIntersectAxis::FindPoint(const QPointF &axisPoint, qreal angle,
     QRectF rectangle = QRectF(0, 0, INT_MAX, INT_MAX);
     rectangle.translate(-INT_MAX/2.0, -INT_MAX/2.0);
 
+    // Tessellate the curve only once for both directions of the axis
+    const VCurveIntersection curveIndex(curve->getPoints());
+
     QLineF axis = QLineF(axisPoint, VGObject::BuildRay(axisPoint, angle, rectangle));
-    QVector<QPointF> points = curve->IntersectLine(axis);
+    QVector<QPointF> points = curveIndex.IntersectLine(axis);
 
     if (points.isEmpty())
     {
         QLineF axis2 = QLineF(axisPoint, VGObject::BuildRay(axisPoint, angle + 180, rectangle));
-        points = curve->IntersectLine(axis2);
+        points = curveIndex.IntersectLine(axis2);
     }
 
     if (points.size() > 0)
@@ -55,6 +55,7 @@
 #include "../ifc/ifcdef.h"
 #include "../ifc/exception/vexception.h"
 #include "../vgeometry/vabstractcurve.h"
+#include "../vgeometry/vcurveintersection.h"
 #include "../vgeometry/vgobject.h"
 #include "../vgeometry/vpointf.h"
 #include "../vmisc/vabstractapplication.h"
@@ -207,12 +208,7 @@ QPointF VToolPointOfIntersectionCurves::FindPoint(const QVector<QPointF> &curve1
         return QPointF();
     }
 
-    QVector<QPointF> intersections;
-    for ( auto i = 0; i < curve1Points.count()-1; ++i )
-    {
-        intersections << VAbstractCurve::CurveIntersectLine(curve2Points,
-                                                            QLineF(curve1Points.at(i), curve1Points.at(i+1)));
-    }
+    const QVector<QPointF> intersections = VCurveIntersection::CurvesIntersections(curve1Points, curve2Points);
 
     if (intersections.isEmpty())
     {
@@ -567,32 +567,8 @@ void VAbstractTool::ToolCreation(const Source &typeCreation)
  */
 void VAbstractTool::AddRecord(const quint32 id, const Tool &toolType, VAbstractPattern *doc)
 {
-    QVector<VToolRecord> *history = doc->getHistory();
-    VToolRecord record = VToolRecord(id, toolType, doc->getActiveDraftBlockName());
-    if (history->contains(record))
-    {
-        return;
-    }
-
-    quint32 cursor = doc->getCursor();
-    if (cursor == NULL_ID)
-    {
-        history->append(record);
-    }
-    else
-    {
-        qint32 index = 0;
-        for (qint32 i = 0; i<history->size(); ++i)
-        {
-            VToolRecord rec = history->at(i);
-            if (rec.getId() == cursor)
-            {
-                index = i;
-                break;
-            }
-        }
-        history->insert(index+1, record);
-    }
+    const VToolRecord record = VToolRecord(id, toolType, doc->getActiveDraftBlockName());
+    doc->addHistoryRecord(record, doc->getCursor());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -87,7 +87,7 @@ void DelGroup::undo()
     if (not groups.isNull())
     {
         groups.appendChild(xml);
-        doc->parseGroups(groups);
+        doc->indexGroup(xml);
         emit updateGroups();
     }
     else
@@ -113,12 +113,12 @@ void DelGroup::redo()
         if (group.isElement())
         {
             group.setAttribute(VAbstractPattern::AttrVisible, trueStr);
-            doc->parseGroups(groups);
             if (groups.removeChild(group).isNull())
             {
                 qCDebug(vUndo, "Can't delete group.");
                 return;
             }
+            doc->unindexGroup(nodeId);
             emit updateGroups();
 
             if (groups.childNodes().isEmpty())
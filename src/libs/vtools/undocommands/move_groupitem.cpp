@@ -79,15 +79,10 @@ void MoveGroupItem::undo()
         doc->SetModified(false);
         emit qApp->getCurrentDocument()->patternChanged(true);
 
-        QDomElement groups = doc->createGroups();
-        if (not groups.isNull())
-        {
-            doc->parseGroups(groups);
-        } else
-        {
-            qCDebug(vUndo, "Can't get tag Groups.");
-            return;
-        }
+        doc->unindexGroupItem(m_destinationGroupId, doc->GetParametrUInt(m_dest, QString("tool"), NULL_ID_STR),
+                              doc->GetParametrUInt(m_dest, QString("object"), NULL_ID_STR));
+        doc->indexGroupItem(m_sourceGroupId, doc->GetParametrUInt(m_source, QString("tool"), NULL_ID_STR),
+                            doc->GetParametrUInt(m_source, QString("object"), NULL_ID_STR));
 
         emit updateGroups();
     }
@@ -128,15 +123,10 @@ void MoveGroupItem::redo()
         doc->SetModified(false);
         emit qApp->getCurrentDocument()->patternChanged(true);
 
-        QDomElement groups = doc->createGroups();
-        if (not groups.isNull())
-        {
-            doc->parseGroups(groups);
-        } else
-        {
-            qCDebug(vUndo, "Can't get tag Groups.");
-            return;
-        }
+        doc->unindexGroupItem(m_sourceGroupId, doc->GetParametrUInt(m_source, QString("tool"), NULL_ID_STR),
+                              doc->GetParametrUInt(m_source, QString("object"), NULL_ID_STR));
+        doc->indexGroupItem(m_destinationGroupId, doc->GetParametrUInt(m_dest, QString("tool"), NULL_ID_STR),
+                            doc->GetParametrUInt(m_dest, QString("object"), NULL_ID_STR));
 
         emit updateGroups();
     }
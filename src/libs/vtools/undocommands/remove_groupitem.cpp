@@ -68,15 +68,9 @@ void RemoveGroupItem::undo()
         doc->SetModified(false);
         emit qApp->getCurrentDocument()->patternChanged(true);
 
-        QDomElement groups = doc->createGroups();
-        if (not groups.isNull())
-        {
-            doc->parseGroups(groups);
-        } else
-        {
-            qCDebug(vUndo, "Can't get tag Groups.");
-            return;
-        }
+        quint32 objectId = doc->GetParametrUInt(xml,QString("object"),NULL_ID_STR);
+        quint32 toolId = doc->GetParametrUInt(xml,QString("tool"),NULL_ID_STR);
+        doc->indexGroupItem(nodeId, toolId, objectId);
 
         emit updateGroups();
     }
@@ -108,22 +102,11 @@ void RemoveGroupItem::redo()
         doc->SetModified(true);
         emit qApp->getCurrentDocument()->patternChanged(false);
 
-        // set the item visible. Because if the undo is done when unvisibile and it's not in any group after the
-        // undo, it stays unvisible until the entire drawing is completly rerendered.
+        // update the item visibility. If it's not in any group after the undo it must be visible again,
+        // otherwise it stays invisible until the entire drawing is completly rerendered.
         quint32 objectId = doc->GetParametrUInt(xml,QString("object"),NULL_ID_STR);
         quint32 toolId = doc->GetParametrUInt(xml,QString("tool"),NULL_ID_STR);
-        VDataTool* tool = doc->getTool(toolId);
-        tool->GroupVisibility(objectId,true);
-
-        QDomElement groups = doc->createGroups();
-        if (not groups.isNull())
-        {
-            doc->parseGroups(groups);
-        } else
-        {
-            qCDebug(vUndo, "Can't get tag Groups.");
-            return;
-        }
+        doc->unindexGroupItem(nodeId, toolId, objectId);
 
         emit updateGroups();
     }
@@ -0,0 +1,156 @@
+/***************************************************************************
+ **  @file   set_pieces_attribute.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "set_pieces_attribute.h"
+
+#include <QDomElement>
+#include <QHash>
+#include <QMessageLogger>
+#include <QtDebug>
+
+#include "vundocommand.h"
+#include "../ifc/ifcdef.h"
+#include "../ifc/xml/vabstractpattern.h"
+#include "../vmisc/vabstractapplication.h"
+#include "../vmisc/def.h"
+#include "../vmisc/logging.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/vpiece.h"
+#include "../vwidgets/vabstractmainwindow.h"
+#include "../vwidgets/vmaingraphicsscene.h"
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+bool pieceState(const VPiece &piece, const QString &attribute)
+{
+    return attribute == AttrPieceLocked ? piece.isLocked() : piece.isInLayout();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void setPieceState(VPiece &piece, const QString &attribute, bool state)
+{
+    if (attribute == AttrPieceLocked)
+    {
+        piece.setIsLocked(state);
+    }
+    else
+    {
+        piece.SetInLayout(state);
+    }
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetPiecesAttribute
+ * @param attribute AttrInLayout or AttrPieceLocked.
+ * @param states new state of each piece, by piece id.
+ */
+SetPiecesAttribute::SetPiecesAttribute(const QString &attribute, const QMap<quint32, bool> &states,
+                                       VContainer *data, VAbstractPattern *doc, QUndoCommand *parent)
+    : VUndoCommand(QDomElement(), doc, parent)
+    , m_attribute(attribute)
+    , m_data(data)
+    , m_oldStates()
+    , m_newStates(states)
+{
+    SCASSERT(attribute == AttrInLayout || attribute == AttrPieceLocked)
+    setText(attribute == AttrPieceLocked ? tr("Pattern pieces lock") : tr("Pieces in Layout List"));
+
+    const QHash<quint32, VPiece> *pieces = m_data->DataPieces();
+    auto i = m_newStates.constBegin();
+    while (i != m_newStates.constEnd())
+    {
+        m_oldStates.insert(i.key(), pieceState(pieces->value(i.key()), m_attribute));
+        ++i;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+SetPiecesAttribute::~SetPiecesAttribute()
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SetPiecesAttribute::undo()
+{
+    qCDebug(vUndo, "SetPiecesAttribute::undo().");
+    doCmd(m_oldStates);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SetPiecesAttribute::redo()
+{
+    qCDebug(vUndo, "SetPiecesAttribute::redo().");
+    doCmd(m_newStates);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SetPiecesAttribute::doCmd(const QMap<quint32, bool> &states)
+{
+    VMainGraphicsScene *scene = qobject_cast<VMainGraphicsScene *>(qApp->getCurrentScene());
+
+    QVector<quint32> changed;
+    changed.reserve(states.size());
+
+    auto i = states.constBegin();
+    while (i != states.constEnd())
+    {
+        const quint32 id = i.key();
+        const bool state = i.value();
+        ++i;
+
+        QDomElement element = doc->elementById(id, VAbstractPattern::TagPiece);
+        if (not element.isElement())
+        {
+            qDebug("Can't get piece by id = %u.", id);
+            continue;
+        }
+
+        doc->SetAttribute(element, m_attribute, state);
+
+        VPiece piece = m_data->DataPieces()->value(id);
+        setPieceState(piece, m_attribute, state);
+        m_data->UpdatePiece(id, piece);
+
+        if (m_attribute == AttrPieceLocked && scene != nullptr)
+        {
+            emit scene->pieceLockedChanged(id, not state);
+        }
+
+        changed.append(id);
+    }
+
+    if (changed.isEmpty())
+    {
+        return;
+    }
+
+    emit updateList(changed);
+
+    VAbstractMainWindow *window = qobject_cast<VAbstractMainWindow *>(qApp->getMainWindow());
+    SCASSERT(window != nullptr)
+    window->ShowToolTip(text());
+}
@@ -0,0 +1,68 @@
+/***************************************************************************
+ **  @file   set_pieces_attribute.h
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#ifndef SET_PIECES_ATTRIBUTE_H
+#define SET_PIECES_ATTRIBUTE_H
+
+#include <qcompilerdetection.h>
+#include <QMap>
+#include <QMetaObject>
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+#include "vundocommand.h"
+
+/**
+ * @brief The SetPiecesAttribute class changes a boolean attribute (in layout or locked) of several pieces as one undo
+ * step.
+ *
+ * All pieces are updated in one pass over the document and the container, without parsing the pattern. Listeners get
+ * one updateList signal with the ids of the changed pieces.
+ */
+class SetPiecesAttribute : public VUndoCommand
+{
+    Q_OBJECT
+public:
+                        SetPiecesAttribute(const QString &attribute, const QMap<quint32, bool> &states,
+                                           VContainer *data, VAbstractPattern *doc, QUndoCommand *parent = nullptr);
+    virtual            ~SetPiecesAttribute();
+    virtual void        undo() Q_DECL_OVERRIDE;
+    virtual void        redo() Q_DECL_OVERRIDE;
+
+signals:
+    void                updateList(const QVector<quint32> &ids);
+
+private:
+                        Q_DISABLE_COPY(SetPiecesAttribute)
+    QString             m_attribute;
+    VContainer         *m_data;
+    QMap<quint32, bool> m_oldStates;
+    QMap<quint32, bool> m_newStates;
+
+    void                doCmd(const QMap<quint32, bool> &states);
+};
+
+#endif // SET_PIECES_ATTRIBUTE_H
@@ -19,6 +19,7 @@ HEADERS += \
     $$PWD/adddetnode.h \
     $$PWD/set_piece_color.h \
     $$PWD/toggle_piecelock.h \
+    $$PWD/set_pieces_attribute.h \
     $$PWD/vundocommand.h \
     $$PWD/label/movelabel.h \
     $$PWD/label/movedoublelabel.h \
@@ -52,6 +53,7 @@ SOURCES += \
     $$PWD/adddetnode.cpp \
     $$PWD/set_piece_color.cpp \
     $$PWD/toggle_piecelock.cpp \
+    $$PWD/set_pieces_attribute.cpp \
     $$PWD/vundocommand.cpp \
     $$PWD/label/movelabel.cpp \
     $$PWD/label/movedoublelabel.cpp \
@@ -69,6 +69,7 @@
 #include <QGraphicsItem>
 #include <QGraphicsLineItem>
 #include <QLineF>
+#include <QPair>
 #include <QMessageLogger>
 #include <QPen>
 #include <QPointF>
@@ -77,11 +78,55 @@
 #include <QString>
 #include <Qt>
 #include <QtDebug>
+#include <QVector>
 
 template <class K, class V> class QHash;
 
 Q_LOGGING_CATEGORY(vVis, "v.visualization")
 
+namespace
+{
+/**
+ * @brief The PreviewValue struct remembers last formula evaluated for preview and values of variables it used.
+ */
+struct PreviewValue
+{
+    PreviewValue()
+        : vars(nullptr),
+          expression(),
+          osSeparator(false),
+          inputs(),
+          value(0)
+    {}
+
+    bool IsValid(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QString &expression,
+                 bool osSeparator) const
+    {
+        if (this->vars == nullptr || this->vars != vars || this->osSeparator != osSeparator
+                || this->expression != expression)
+        {
+            return false;
+        }
+
+        for (int i = 0; i < inputs.size(); ++i)
+        {
+            const QSharedPointer<const VInternalVariable> variable = vars->value(inputs.at(i).first);
+            if (variable.isNull() || variable->GetValue() != inputs.at(i).second)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const QHash<QString, QSharedPointer<VInternalVariable> > *vars;
+    QString expression;
+    bool    osSeparator;
+    QVector<QPair<QString, qreal> > inputs;
+    qreal   value;
+};
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 Visualization::Visualization(const VContainer *data)
     : QObject()
@@ -191,19 +236,47 @@ qreal Visualization::FindVal(const QString &expression,
     }
     else
     {
+        const bool osSeparator = qApp->Settings()->GetOsSeparator();
+
+        // Previews refresh on every mouse move, almost always with the same formula. Reuse last value while variables
+        // it depends on keep their values.
+        static thread_local PreviewValue last;
+        if (last.IsValid(vars, expression, osSeparator))
+        {
+            return last.value;
+        }
+
+        // Creating parser is expensive, so reuse one instance.
+        static thread_local Calculator cal;
+        last = PreviewValue();
+
         try
         {
             // Replace line return with spaces for calc if exist
             QString formula = expression;
             formula.replace("\n", " ");
-            formula = qApp->TrVars()->FormulaFromUser(formula, qApp->Settings()->GetOsSeparator());
-            QScopedPointer<Calculator> cal(new Calculator());
-            val = cal->EvalFormula(vars, formula);
+            formula = qApp->TrVars()->FormulaFromUser(formula, osSeparator);
+            cal.ClearVar();
+            val = cal.EvalFormula(vars, formula);
 
             if (qIsInf(val) || qIsNaN(val))
             {
                 val = 0;
             }
+
+            last.vars = vars;
+            last.expression = expression;
+            last.osSeparator = osSeparator;
+            last.value = val;
+            const QMap<int, QString> tokens = cal.FindVariables();
+            for (auto i = tokens.constBegin(); i != tokens.constEnd(); ++i)
+            {
+                const QSharedPointer<const VInternalVariable> variable = vars->value(i.value());
+                if (not variable.isNull())
+                {
+                    last.inputs.append(qMakePair(i.value(), variable->GetValue()));
+                }
+            }
         }
         catch (qmu::QmuParserError &error)
         {
@@ -55,6 +55,12 @@
 #include <QGraphicsItem>
 #include <QGraphicsScene>
 #include <QGraphicsView>
+#include <QPainter>
+#include <QPolygonF>
+#include <QStyleOptionGraphicsItem>
+#include <QtMath>
+
+#include <cmath>
 
 const qreal defPointRadiusPixel = (2./*mm*/ / 25.4) * PrintDPI;
 const qreal widthMainLine = (1.2/*mm*/ / 25.4) * PrintDPI;
@@ -76,6 +82,20 @@ qreal sceneScale(QGraphicsScene *scene)
     return scale;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief painterScale return view scale an item is painted with.
+ *
+ * Unlike sceneScale() it doesn't look up the views, and it is also right when the scene is rendered for export.
+ * @param painter painter passed to paint().
+ * @return 1 for 100% zoom.
+ */
+qreal painterScale(const QPainter *painter)
+{
+    SCASSERT(painter != nullptr)
+    return painter->worldTransform().m11();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QColor correctColor(const QGraphicsItem *item, const QColor &color)
 {
@@ -163,3 +183,86 @@ QPainterPath ItemShapeFromPath(const QPainterPath &path, const QPen &pen)
     p.addPath(path);
     return p;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief levelOfDetail return level of detail for current painter transformation.
+ * @param painter painter passed to paint().
+ * @return 1 for 100% zoom, smaller values when zoomed out.
+ */
+qreal levelOfDetail(const QPainter *painter)
+{
+    SCASSERT(painter != nullptr)
+    return QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief levelOfDetailBand split levels of detail into half-octave bands.
+ *
+ * Items cache simplified geometry per band, so small zoom steps don't require rebuilding it.
+ * @param lod level of detail.
+ * @return band number.
+ */
+int levelOfDetailBand(qreal lod)
+{
+    return qFloor(std::log2(qMax(lod, 0.0001)) * 2);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief levelOfDetailBandTolerance decimation tolerance in scene units good for any zoom inside the band.
+ * @param band band number.
+ * @param tolerancePixel maximal deviation on screen in pixels.
+ * @return tolerance.
+ */
+qreal levelOfDetailBandTolerance(int band, qreal tolerancePixel)
+{
+    // Lowest level of detail in the band gives the largest tolerance, use the highest one to stay within the limit.
+    return tolerancePixel / qPow(2, (band + 1) / 2.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief decimatePath convert path to polyline skipping vertices closer than tolerance to the previous kept one.
+ * @param path source path.
+ * @param tolerance minimal distance between vertices in scene units.
+ * @return simplified path. First and last vertices of each subpath are always kept.
+ */
+QPainterPath decimatePath(const QPainterPath &path, qreal tolerance)
+{
+    QPainterPath decimated;
+    const qreal sqTolerance = tolerance * tolerance;
+
+    const QList<QPolygonF> subpaths = path.toSubpathPolygons();
+    for (auto &polygon : subpaths)
+    {
+        if (polygon.isEmpty())
+        {
+            continue;
+        }
+
+        const QPointF *points = polygon.constData();
+        const int count = polygon.size();
+
+        decimated.moveTo(points[0]);
+        QPointF last = points[0];
+        for (int i = 1; i < count - 1; ++i)
+        {
+            const qreal dx = points[i].x() - last.x();
+            const qreal dy = points[i].y() - last.y();
+            if (dx * dx + dy * dy >= sqTolerance)
+            {
+                decimated.lineTo(points[i]);
+                last = points[i];
+            }
+        }
+
+        if (count > 1)
+        {
+            decimated.lineTo(points[count - 1]);
+        }
+    }
+
+    return decimated;
+}
@@ -67,8 +67,10 @@ class QColor;
 class QRectF;
 class QPainterPath;
 class QPen;
+class QPainter;
 
 qreal sceneScale(QGraphicsScene *scene);
+qreal painterScale(const QPainter *painter);
 
 QColor correctColor(const QGraphicsItem *item, const QColor &color);
 
@@ -80,4 +82,9 @@ qreal  scaleWidth(qreal width, qreal scale);
 
 QPainterPath ItemShapeFromPath(const QPainterPath &path, const QPen &pen);
 
+qreal        levelOfDetail(const QPainter *painter);
+int          levelOfDetailBand(qreal lod);
+qreal        levelOfDetailBandTolerance(int band, qreal tolerancePixel);
+QPainterPath decimatePath(const QPainterPath &path, qreal tolerance);
+
 #endif // GLOBAL_H
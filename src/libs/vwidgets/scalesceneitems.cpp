@@ -50,12 +50,17 @@
  *************************************************************************/
 
 #include "scalesceneitems.h"
-#include "vcurvepathitem.h"
 #include "global.h"
 
 #include <QtCore/qmath.h>
+#include <QPainter>
 #include <QPen>
 
+namespace
+{
+const qreal arrowSize = 10;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VScaledLine::VScaledLine(QGraphicsItem *parent)
     : QGraphicsLineItem(parent),
@@ -68,14 +73,29 @@ VScaledLine::VScaledLine(const QLineF &line, QGraphicsItem *parent)
       basicWidth(widthMainLine)
 {}
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief boundingRect bounds of the line drawn with its basic width.
+ *
+ * paint() only makes the stroke thinner when zoomed in, so the bounds don't depend on zoom and never change in paint.
+ */
+QRectF VScaledLine::boundingRect() const
+{
+    const qreal halfWidth = basicWidth/2.0;
+    return QRectF(line().p1(), line().p2()).normalized().adjusted(-halfWidth, -halfWidth, halfWidth, halfWidth);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VScaledLine::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
+    Q_UNUSED(option)
+    Q_UNUSED(widget)
+
     QPen lPen = pen();
-    lPen.setWidthF(scaleWidth(basicWidth, sceneScale(scene())));
-    setPen(lPen);
+    lPen.setWidthF(scaleWidth(basicWidth, painterScale(painter)));
 
-    QGraphicsLineItem::paint(painter, option, widget);
+    painter->setPen(lPen);
+    painter->drawLine(line());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -87,55 +107,76 @@ qreal VScaledLine::GetBasicWidth() const
 //---------------------------------------------------------------------------------------------------------------------
 void VScaledLine::setBasicWidth(const qreal &value)
 {
+    prepareGeometryChange();
     basicWidth = value;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 ArrowedLineItem::ArrowedLineItem(QGraphicsItem *parent)
     : QGraphicsLineItem(parent)
-    , m_arrows(new VCurvePathItem(this))
+    , m_arrows()
+    , m_arrowsLine()
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
 ArrowedLineItem::ArrowedLineItem(const QLineF &line, QGraphicsItem *parent)
     : QGraphicsLineItem(line, parent)
-    , m_arrows(new VCurvePathItem(this))
+    , m_arrows()
+    , m_arrowsLine()
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
-void ArrowedLineItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+/**
+ * @brief boundingRect bounds of the line with its arrows drawn with the main line width.
+ */
+QRectF ArrowedLineItem::boundingRect() const
 {
-    QPen lPen = pen();
-    lPen.setWidthF(scaleWidth(widthMainLine, sceneScale(scene())));
-    setPen(lPen);
-    m_arrows->setPen(lPen);
-
-    QPainterPath path;
-    path.moveTo(line().p1());
-    path.lineTo(line().p2());
+    const qreal extra = arrowSize + widthMainLine/2.0;
+    return QRectF(line().p1(), line().p2()).normalized().adjusted(-extra, -extra, extra, extra);
+}
 
-    qreal arrow_step = 60;
-    qreal arrow_size = 10;
+//---------------------------------------------------------------------------------------------------------------------
+void ArrowedLineItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    Q_UNUSED(option)
+    Q_UNUSED(widget)
 
-    if (line().length() < arrow_step)
+    // Arrows depend only on the line, build the path again only when the line was moved.
+    if (line() != m_arrowsLine)
     {
-        drawArrow(line(), path, arrow_size);
+        m_arrowsLine = line();
+
+        QPainterPath path;
+        path.moveTo(m_arrowsLine.p1());
+        path.lineTo(m_arrowsLine.p2());
+
+        qreal arrow_step = 60;
+
+        if (m_arrowsLine.length() < arrow_step)
+        {
+            drawArrow(m_arrowsLine, path, arrowSize);
+        }
+
+        QLineF axis;
+        axis.setP1(m_arrowsLine.p1());
+        axis.setAngle(m_arrowsLine.angle());
+        axis.setLength(arrow_step);
+
+        int steps = qFloor(m_arrowsLine.length()/arrow_step);
+        for (int i=0; i<steps; ++i)
+        {
+            drawArrow(axis, path, arrowSize);
+            axis.setLength(axis.length()+arrow_step);
+        }
+        m_arrows = path;
     }
 
-    QLineF axis;
-    axis.setP1(line().p1());
-    axis.setAngle(line().angle());
-    axis.setLength(arrow_step);
-
-    int steps = qFloor(line().length()/arrow_step);
-    for (int i=0; i<steps; ++i)
-    {
-        drawArrow(axis, path, arrow_size);
-        axis.setLength(axis.length()+arrow_step);
-    }
-    m_arrows->setPath(path);
+    QPen lPen = pen();
+    lPen.setWidthF(scaleWidth(widthMainLine, painterScale(painter)));
 
-    QGraphicsLineItem::paint(painter, option, widget);
+    painter->setPen(lPen);
+    painter->setBrush(Qt::NoBrush);
+    painter->drawPath(m_arrows);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -163,17 +204,29 @@ VScaledEllipse::VScaledEllipse(QGraphicsItem *parent)
     : QGraphicsEllipseItem(parent)
 {}
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief boundingRect bounds of the point circle at 100% zoom.
+ *
+ * paint() only makes the circle smaller when zoomed in, so the bounds don't depend on zoom and never change in paint.
+ */
+QRectF VScaledEllipse::boundingRect() const
+{
+    return PointRect(defPointRadiusPixel + widthMainLine/2.0);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VScaledEllipse::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    const qreal scale = sceneScale(scene());
-    const qreal width = scaleWidth(widthMainLine, scale);
+    Q_UNUSED(option)
+    Q_UNUSED(widget)
 
-    QPen visPen = pen();
-    visPen.setWidthF(width);
+    const qreal scale = painterScale(painter);
 
-    setPen(visPen);
-    scaleCircleSize(this, scale);
+    QPen visPen = pen();
+    visPen.setWidthF(scaleWidth(widthMainLine, scale));
 
-    QGraphicsEllipseItem::paint(painter, option, widget);
+    painter->setPen(visPen);
+    painter->setBrush(brush());
+    painter->drawEllipse(PointRect(scaledRadius(scale)));
 }
@@ -69,6 +69,7 @@ class VScaledLine : public QGraphicsLineItem
     virtual int  type() const Q_DECL_OVERRIDE {return Type;}
     enum { Type = UserType + static_cast<int>(Vis::ScaledLine)};
 
+    virtual QRectF boundingRect() const Q_DECL_OVERRIDE;
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                        QWidget *widget = nullptr) Q_DECL_OVERRIDE;
 
@@ -91,13 +92,15 @@ class ArrowedLineItem : public QGraphicsLineItem
     virtual int  type() const Q_DECL_OVERRIDE {return Type;}
     enum { Type = UserType + static_cast<int>(Vis::ArrowedLineItem)};
 
+    virtual QRectF boundingRect() const Q_DECL_OVERRIDE;
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                        QWidget *widget = nullptr) Q_DECL_OVERRIDE;
 
 private:
     Q_DISABLE_COPY(ArrowedLineItem)
     void           drawArrow(const QLineF &axis, QPainterPath &path, const qreal &arrow_size);
-    VCurvePathItem *m_arrows;
+    QPainterPath    m_arrows;
+    QLineF          m_arrowsLine;
 };
 
 class VScaledEllipse : public QGraphicsEllipseItem
@@ -109,6 +112,7 @@ class VScaledEllipse : public QGraphicsEllipseItem
     virtual int  type() const Q_DECL_OVERRIDE {return Type;}
     enum { Type = UserType + static_cast<int>(Vis::ScaledEllipse)};
 
+    virtual QRectF boundingRect() const Q_DECL_OVERRIDE;
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                        QWidget *widget = nullptr) Q_DECL_OVERRIDE;
 private:
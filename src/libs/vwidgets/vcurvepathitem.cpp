@@ -52,14 +52,19 @@
 #include "vcurvepathitem.h"
 #include "../vwidgets/global.h"
 #include "../vgeometry/vabstractcurve.h"
+#include "../vmisc/vabstractapplication.h"
 
 #include <QPainter>
+#include <QStyleOptionGraphicsItem>
 
 //---------------------------------------------------------------------------------------------------------------------
 VCurvePathItem::VCurvePathItem(QGraphicsItem *parent)
     : QGraphicsPathItem(parent),
       m_directionArrows(),
-      m_points()
+      m_points(),
+      m_lodSourcePath(),
+      m_lodPath(),
+      m_lodBand(0)
 {
 }
 
@@ -97,6 +102,16 @@ void VCurvePathItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
 {
     ScalePenWidth();
 
+    const qreal lod = levelOfDetail(painter);
+    if (lod < qApp->Settings()->getLodSimpleCurves() && not (option->state & QStyle::State_Selected))
+    {
+        // Too far to see direction arrows and every vertex
+        painter->setPen(pen());
+        painter->setBrush(brush());
+        painter->drawPath(DecimatedPath(lod));
+        return;
+    }
+
     const QPainterPath arrowsPath = VAbstractCurve::ShowDirection(m_directionArrows,
                                                                   scaleWidth(VAbstractCurve::lengthCurveDirectionArrow,
                                                                              sceneScale(scene())));
@@ -140,3 +155,25 @@ void VCurvePathItem::ScalePenWidth()
 
     setPen(toolPen);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DecimatedPath return path simplified for the zoom band of lod.
+ *
+ * Result is cached. Unchanged path shares data with the cached source, so the check is cheap.
+ * @param lod level of detail.
+ * @return simplified path.
+ */
+const QPainterPath &VCurvePathItem::DecimatedPath(qreal lod)
+{
+    const int band = levelOfDetailBand(lod);
+    const QPainterPath currentPath = path();
+    if (band != m_lodBand || currentPath != m_lodSourcePath || (m_lodPath.isEmpty() && not currentPath.isEmpty()))
+    {
+        m_lodSourcePath = currentPath;
+        m_lodBand = band;
+        m_lodPath = decimatePath(currentPath,
+                                 levelOfDetailBandTolerance(band, qApp->Settings()->getLodCurveTolerance()));
+    }
+    return m_lodPath;
+}
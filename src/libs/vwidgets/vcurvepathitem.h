@@ -80,6 +80,13 @@ class VCurvePathItem : public QGraphicsPathItem
 
     QVector<QPair<QLineF, QLineF>> m_directionArrows;
     QVector<QPointF> m_points;
+
+    /** @brief Decimated copy of path for low zoom, valid while path and zoom band don't change. */
+    QPainterPath m_lodSourcePath;
+    QPainterPath m_lodPath;
+    int          m_lodBand;
+
+    const QPainterPath &DecimatedPath(qreal lod);
 };
 
 #endif // VCURVEPATHITEM_H
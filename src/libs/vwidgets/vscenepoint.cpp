@@ -59,7 +59,9 @@
 
 #include <QBrush>
 #include <QFont>
+#include <QPainter>
 #include <QPen>
+#include <QStyleOptionGraphicsItem>
 #include <QColor>
 #include <QtDebug>
 
@@ -120,6 +122,16 @@ void VScenePoint::paint(QPainter *painter, const QStyleOptionGraphicsItem *optio
         }
     }
 
+    if (levelOfDetail(painter) < qApp->Settings()->getLodSimplePoints() && not (option->state & QStyle::State_Selected))
+    {
+        // Point is too small to see the circle, one pixel is enough
+        QPen pointPen(pen().color());
+        pointPen.setCosmetic(true);
+        painter->setPen(pointPen);
+        painter->drawPoint(rect().center());
+        return;
+    }
+
     QGraphicsEllipseItem::paint(painter, option, widget);
 }
 
@@ -45,6 +45,7 @@
 #include "../vmisc/vcommonsettings.h"
 #include "../vmisc/vabstractapplication.h"
 #include "vtextgraphicsitem.h"
+#include "global.h"
 
 const qreal resizeSquare = (3./*mm*/ / 25.4) * PrintDPI;
 const qreal rotateCircle = (2./*mm*/ / 25.4) * PrintDPI;
@@ -162,33 +163,15 @@ void VTextGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
 
     QFont font = m_textMananger.GetFont();
     int width = qFloor(boundingRect().width());
-    // draw text lines
-    int yPos = 0;
-    for (int i = 0; i < m_textMananger.GetSourceLinesCount(); ++i)
-    {
-        const TextLine& textLine = m_textMananger.GetSourceLine(i);
-
-        font.setPixelSize(m_textMananger.GetFont().pixelSize() + textLine.m_iFontSize);
-        font.setBold(textLine.bold);
-        font.setItalic(textLine.italic);
-
-        QString text = textLine.m_text;
-        QFontMetrics fm(font);
 
-        // check if the next line will go out of bounds
-        if (yPos + fm.height() > boundingRect().height())
-        {
-            break;
-        }
-
-        if (fm.horizontalAdvance(text) > width)
-        {
-            text = fm.elidedText(text, Qt::ElideMiddle, width);
-        }
-
-        painter->setFont(font);
-        painter->drawText(0, yPos, width, fm.height(), static_cast<int>(textLine.m_eAlign), text);
-        yPos += fm.height() + m_textMananger.GetSpacing();
+    if (font.pixelSize() > 0 && font.pixelSize() * levelOfDetail(painter) < qApp->Settings()->getLodMinTextHeight())
+    {
+        // Text is too small to read, mark lines with bars instead of shaping every glyph
+        DrawTextPlaceholder(painter, color, width);
+    }
+    else
+    {
+        DrawTextLines(painter, font, width);
     }
 
     // now draw the features specific to non-normal modes
@@ -240,6 +223,79 @@ void VTextGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DrawTextLines draws label lines, eliding the ones that are too wide.
+ * @param painter pointer to the QPainter in use
+ * @param font base font of the label
+ * @param width available width
+ */
+void VTextGraphicsItem::DrawTextLines(QPainter *painter, QFont font, int width) const
+{
+    // draw text lines
+    int yPos = 0;
+    for (int i = 0; i < m_textMananger.GetSourceLinesCount(); ++i)
+    {
+        const TextLine& textLine = m_textMananger.GetSourceLine(i);
+
+        font.setPixelSize(m_textMananger.GetFont().pixelSize() + textLine.m_iFontSize);
+        font.setBold(textLine.bold);
+        font.setItalic(textLine.italic);
+
+        QString text = textLine.m_text;
+        QFontMetrics fm(font);
+
+        // check if the next line will go out of bounds
+        if (yPos + fm.height() > boundingRect().height())
+        {
+            break;
+        }
+
+        if (fm.horizontalAdvance(text) > width)
+        {
+            text = fm.elidedText(text, Qt::ElideMiddle, width);
+        }
+
+        painter->setFont(font);
+        painter->drawText(0, yPos, width, fm.height(), static_cast<int>(textLine.m_eAlign), text);
+        yPos += fm.height() + m_textMananger.GetSpacing();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DrawTextPlaceholder draws a bar for each label line. Used when text is too small to read.
+ * @param painter pointer to the QPainter in use
+ * @param color label color
+ * @param width available width
+ */
+void VTextGraphicsItem::DrawTextPlaceholder(QPainter *painter, const QColor &color, int width) const
+{
+    QColor barColor = color;
+    barColor.setAlpha(64);
+
+    painter->save();
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(barColor);
+
+    int yPos = 0;
+    for (int i = 0; i < m_textMananger.GetSourceLinesCount(); ++i)
+    {
+        const TextLine& textLine = m_textMananger.GetSourceLine(i);
+        const int height = m_textMananger.GetFont().pixelSize() + textLine.m_iFontSize;
+
+        if (yPos + height > boundingRect().height())
+        {
+            break;
+        }
+
+        painter->drawRect(QRectF(0, yPos + height/4.0, width, height/2.0));
+        yPos += height + m_textMananger.GetSpacing();
+    }
+
+    painter->restore();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief VTextGraphicsItem::setSize Tries to set the label size to (width, height).
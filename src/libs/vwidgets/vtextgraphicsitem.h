@@ -43,6 +43,9 @@
 #include "vpieceitem.h"
 #include "../vlayout/vtextmanager.h"
 
+class QColor;
+class QPainter;
+
 /**
  * @brief The VTextGraphicsItem class. This class implements text graphics item,
  * which can be dragged around, resized and rotated within the parent item. The text font
@@ -97,6 +100,9 @@ class VTextGraphicsItem : public VPieceItem
     void allUserModifications(const QPointF &pos);
     void userRotateAndMove();
     void userMoveAndResize(const QPointF &pos);
+
+    void DrawTextLines(QPainter *painter, QFont font, int width) const;
+    void DrawTextPlaceholder(QPainter *painter, const QColor &color, int width) const;
 };
 
 #endif // VTEXTGRAPHICSITEM_H
@@ -0,0 +1,183 @@
+/***************************************************************************
+ **  @file   main.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include <QtTest>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryFile>
+#include <QXmlStreamReader>
+
+#include "tst_patternbenchmark.h"
+#include "core/vapplication.h"
+#include "mainwindow.h"
+#include "../vpatterndb/vpiecenode.h"
+
+namespace
+{
+const QString jsonOption = QStringLiteral("--json");
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BenchmarksToJson convert QtTest XML report to JSON suitable for tracking trends.
+ * @param xmlFileName QtTest report created with "-o file,xml".
+ * @param jsonFileName output file.
+ * @return true if all is good.
+ */
+bool BenchmarksToJson(const QString &xmlFileName, const QString &jsonFileName)
+{
+    QFile xmlFile(xmlFileName);
+    if (not xmlFile.open(QIODevice::ReadOnly))
+    {
+        qWarning("Can't read benchmark report %s.", qUtf8Printable(xmlFileName));
+        return false;
+    }
+
+    QJsonArray results;
+    QString function;
+    QXmlStreamReader reader(&xmlFile);
+    while (not reader.atEnd())
+    {
+        if (reader.readNext() != QXmlStreamReader::StartElement)
+        {
+            continue;
+        }
+
+        if (reader.name() == QLatin1String("TestFunction"))
+        {
+            function = reader.attributes().value(QLatin1String("name")).toString();
+        }
+        else if (reader.name() == QLatin1String("BenchmarkResult"))
+        {
+            const QXmlStreamAttributes attributes = reader.attributes();
+
+            QJsonObject result;
+            result.insert(QStringLiteral("function"), function);
+            result.insert(QStringLiteral("tag"), attributes.value(QLatin1String("tag")).toString());
+            result.insert(QStringLiteral("metric"), attributes.value(QLatin1String("metric")).toString());
+            result.insert(QStringLiteral("value"), attributes.value(QLatin1String("value")).toDouble());
+            result.insert(QStringLiteral("iterations"), attributes.value(QLatin1String("iterations")).toInt());
+            results.append(result);
+        }
+    }
+
+    if (reader.hasError())
+    {
+        qWarning("Can't parse benchmark report. %s", qUtf8Printable(reader.errorString()));
+        return false;
+    }
+
+    QJsonObject root;
+    root.insert(QStringLiteral("date"), QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    root.insert(QStringLiteral("benchmarks"), results);
+
+    QFile jsonFile(jsonFileName);
+    if (not jsonFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("Can't write %s.", qUtf8Printable(jsonFileName));
+        return false;
+    }
+    jsonFile.write(QJsonDocument(root).toJson());
+    return true;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Accepts all QtTest options plus "--json <file>" that saves results in JSON format.
+ *
+ * In-process benchmarks need Seamly2D application and main window. They run in test mode, because QtTest options are
+ * unknown for Seamly2D command line parser.
+ *
+ * Examples:
+ * BenchmarkTest
+ * BenchmarkTest --json results.json
+ * BenchmarkTest ExportEndToEnd -iterations 5
+ */
+int main(int argc, char** argv)
+{
+    Q_INIT_RESOURCE(cursor);
+    Q_INIT_RESOURCE(icon);
+    Q_INIT_RESOURCE(schema);
+    Q_INIT_RESOURCE(theme);
+    Q_INIT_RESOURCE(flags);
+    Q_INIT_RESOURCE(icons);
+    Q_INIT_RESOURCE(toolicon);
+    Q_INIT_RESOURCE(sounds);
+
+    // Need to internally move a node inside a piece main path
+    qRegisterMetaTypeStreamOperators<VPieceNode>("VPieceNode");
+
+    QStringList arguments;
+    for (int i = 0; i < argc; ++i)
+    {
+        arguments.append(QString::fromLocal8Bit(argv[i]));
+    }
+
+    // The file is required by test mode, but it is never opened. Benchmarks open patterns themselves.
+    QByteArray testOption("--test");
+    QByteArray patternFile("benchmark.val");
+    char *appArgv[] = {argv[0], testOption.data(), patternFile.data(), nullptr};
+    int appArgc = 3;
+
+    VApplication app(appArgc, appArgv);
+    app.InitOptions();
+
+    MainWindow window;
+    app.setMainWindow(&window);
+
+    QString jsonFileName;
+
+    const int jsonIndex = arguments.indexOf(jsonOption);
+    if (jsonIndex > 0 && jsonIndex + 1 < arguments.size())
+    {
+        jsonFileName = arguments.at(jsonIndex + 1);
+        arguments.removeAt(jsonIndex + 1);
+        arguments.removeAt(jsonIndex);
+    }
+
+    QTemporaryFile xmlReport;
+    if (not jsonFileName.isEmpty())
+    {
+        if (not xmlReport.open())
+        {
+            qWarning("Can't create temporary file for benchmark report.");
+            return 1;
+        }
+        xmlReport.close();
+
+        arguments << QStringLiteral("-o") << xmlReport.fileName() + QStringLiteral(",xml")
+                  << QStringLiteral("-o") << QStringLiteral("-,txt");
+    }
+
+    TST_PatternBenchmark benchmark;
+    int status = QTest::qExec(&benchmark, arguments);
+
+    if (not jsonFileName.isEmpty() && not BenchmarksToJson(xmlReport.fileName(), jsonFileName))
+    {
+        status |= 1;
+    }
+
+    return status;
+}
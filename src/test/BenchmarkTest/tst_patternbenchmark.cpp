@@ -0,0 +1,600 @@
+/***************************************************************************
+ **  @file   tst_patternbenchmark.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "tst_patternbenchmark.h"
+#include "core/vapplication.h"
+#include "mainwindow.h"
+#include "xml/vpattern.h"
+#include "../vmisc/def.h"
+#include "../vmisc/vsysexits.h"
+#include "../vmisc/vsettings.h"
+#include "../ifc/exception/vexception.h"
+#include "../ifc/xml/vpatternconverter.h"
+#include "../vlayout/vabstractpiece.h"
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutpiece.h"
+#include "../vtools/tools/vabstracttool.h"
+
+#include <QtTest>
+#include <QLineF>
+#include <QMarginsF>
+#include <QtMath>
+#include <QXmlStreamWriter>
+
+namespace
+{
+const QString tmpBenchmarkFolder = QStringLiteral("tst_benchmark_tmp");
+
+//---------------------------------------------------------------------------------------------------------------------
+QString TmpPath()
+{
+    return QCoreApplication::applicationDirPath() + QDir::separator() + tmpBenchmarkFolder + QDir::separator();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void WriteLabelPosition(QXmlStreamWriter &stream)
+{
+    stream.writeAttribute(QStringLiteral("mx"), QStringLiteral("0.132292"));
+    stream.writeAttribute(QStringLiteral("my"), QStringLiteral("0.264583"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void WriteEndLine(QXmlStreamWriter &stream, quint32 id, const QString &name, quint32 basePoint, qreal angle,
+                  const QString &length, const QString &typeLine)
+{
+    stream.writeEmptyElement(QStringLiteral("point"));
+    stream.writeAttribute(QStringLiteral("type"), QStringLiteral("endLine"));
+    stream.writeAttribute(QStringLiteral("typeLine"), typeLine);
+    stream.writeAttribute(QStringLiteral("id"), QString::number(id));
+    stream.writeAttribute(QStringLiteral("name"), name);
+    stream.writeAttribute(QStringLiteral("basePoint"), QString::number(basePoint));
+    stream.writeAttribute(QStringLiteral("lineColor"), QStringLiteral("black"));
+    stream.writeAttribute(QStringLiteral("angle"), QString::number(angle));
+    stream.writeAttribute(QStringLiteral("length"), length);
+    WriteLabelPosition(stream);
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_PatternBenchmark::TST_PatternBenchmark(QObject *parent)
+    :AbstractTest(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::initTestCase()
+{
+    QDir tmpDir(TmpPath());
+    if (not tmpDir.removeRecursively())
+    {
+        QFAIL("Fail to remove benchmark temp directory.");
+    }
+
+    if (not CopyRecursively(QCoreApplication::applicationDirPath() + QDir::separator() +
+                            QLatin1String("tst_benchmark"), TmpPath()))
+    {
+        QFAIL("Fail to prepare benchmark files.");
+    }
+
+    QVERIFY(GenerateSyntheticPattern(TmpPath() + QLatin1String("synthetic_small.val"), 100, 2, 8));
+    QVERIFY(GenerateSyntheticPattern(TmpPath() + QLatin1String("synthetic_medium.val"), 1000, 10, 24));
+    QVERIFY(GenerateSyntheticPattern(TmpPath() + QLatin1String("synthetic_large.val"), 5000, 40, 64));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::ConvertPattern_data() const
+{
+    AddPatternRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::ConvertPattern()
+{
+    QFETCH(QString, file);
+
+    try
+    {
+        QBENCHMARK
+        {
+            VPatternConverter converter(TmpPath() + file);
+            converter.Convert();
+        }
+    }
+    catch (const VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::FullParse_data() const
+{
+    AddPatternRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FullParse measures VPattern::Parse of an opened pattern: calculation of all objects and creation of tools
+ * and scene items.
+ */
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::FullParse()
+{
+    QFETCH(QString, file);
+
+    VPattern *doc = OpenPattern(TmpPath() + file);
+    QVERIFY2(doc != nullptr, qUtf8Printable(QStringLiteral("Can't open %1.").arg(file)));
+
+    try
+    {
+        QBENCHMARK
+        {
+            doc->Parse(Document::FullParse);
+        }
+    }
+    catch (const VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::LiteParse_data() const
+{
+    AddPatternRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LiteParse measures recalculation after a change in the pattern. Tools already exist, so only objects are
+ * updated.
+ */
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::LiteParse()
+{
+    QFETCH(QString, file);
+
+    VPattern *doc = OpenPattern(TmpPath() + file);
+    QVERIFY2(doc != nullptr, qUtf8Printable(QStringLiteral("Can't open %1.").arg(file)));
+
+    try
+    {
+        QBENCHMARK
+        {
+            doc->Parse(Document::LiteParse);
+        }
+    }
+    catch (const VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::SeamAllowance_data() const
+{
+    QTest::addColumn<int>("nodes");
+
+    QTest::newRow("8 nodes") << 8;
+    QTest::newRow("64 nodes") << 64;
+    QTest::newRow("512 nodes") << 512;
+    QTest::newRow("4096 nodes") << 4096;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::SeamAllowance()
+{
+    QFETCH(int, nodes);
+
+    QVector<VSAPoint> points;
+    points.reserve(nodes);
+    QLineF radius(QPointF(), QPointF(300, 0));
+    for (int i = 0; i < nodes; ++i)
+    {
+        radius.setAngle(360.0 * i / nodes);
+        points.append(VSAPoint(radius.p2()));
+    }
+
+    const qreal width = 38;
+    QVector<QPointF> ekv;
+    QBENCHMARK
+    {
+        ekv = VAbstractPiece::Equidistant(points, width);
+    }
+
+    QVERIFY(not ekv.isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::LayoutGenerate_data() const
+{
+    AddSyntheticRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LayoutGenerate measures nesting of pattern pieces on sheets with default layout options.
+ */
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::LayoutGenerate()
+{
+    QFETCH(QString, file);
+
+    VPattern *doc = OpenPattern(TmpPath() + file);
+    QVERIFY2(doc != nullptr, qUtf8Printable(QStringLiteral("Can't open %1.").arg(file)));
+
+    const QVector<VLayoutPiece> pieces = PreparePieces(doc);
+    QVERIFY(not pieces.isEmpty());
+
+    LayoutErrors state = LayoutErrors::NoError;
+    QBENCHMARK
+    {
+        VLayoutGenerator generator;
+        generator.setPieces(pieces);
+        generator.SetLayoutWidth(VSettings::GetDefLayoutWidth());
+        generator.SetCaseType(VSettings::GetDefLayoutGroup());
+        generator.SetPaperHeight(UnitConvertor(1189/*A0*/, Unit::Mm, Unit::Px));
+        generator.SetPaperWidth(UnitConvertor(841/*A0*/, Unit::Mm, Unit::Px));
+        generator.SetShift(static_cast<quint32>(qFloor(VSettings::GetDefLayoutShift())));
+        generator.SetRotate(VSettings::GetDefLayoutRotate());
+        generator.SetRotationIncrease(VSettings::GetDefLayoutRotationIncrease());
+        generator.SetAutoCrop(VSettings::GetDefLayoutAutoCrop());
+        generator.SetSaveLength(VSettings::GetDefLayoutSaveLength());
+        generator.SetUnitePages(VSettings::GetDefLayoutUnitePages());
+        generator.SetStripOptimization(VSettings::GetDefStripOptimization());
+        generator.SetMultiplier(VSettings::GetDefMultiplier());
+        generator.SetPrinterFields(false, QMarginsF());
+
+        generator.Generate();
+        state = generator.State();
+    }
+
+    QVERIFY(state == LayoutErrors::NoError);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::OpenEndToEnd_data() const
+{
+    AddPatternRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief OpenEndToEnd measures opening of a pattern in test mode: process start, conversion, validation and full
+ * parse.
+ */
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::OpenEndToEnd()
+{
+    QFETCH(QString, file);
+
+    int exit = V_EX_OK;
+    QString error;
+    QBENCHMARK
+    {
+        exit = Run(V_EX_OK, Seamly2DPath(), QStringList() << QStringLiteral("--test") << TmpPath() + file, error);
+    }
+
+    QVERIFY2(exit == V_EX_OK, qUtf8Printable(error));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::ExportEndToEnd_data() const
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<int>("format");
+
+    const QStringList files = QStringList() << QStringLiteral("TestDart.val")
+                                            << QStringLiteral("synthetic_medium.val")
+                                            << QStringLiteral("synthetic_large.val");
+
+    QVector<QPair<QString, LayoutExportFormat> > formats;
+    formats.append(qMakePair(QStringLiteral("SVG"), LayoutExportFormat::SVG));
+    formats.append(qMakePair(QStringLiteral("PDF"), LayoutExportFormat::PDF));
+    formats.append(qMakePair(QStringLiteral("PDF tiled"), LayoutExportFormat::PDFTiled));
+    formats.append(qMakePair(QStringLiteral("PNG"), LayoutExportFormat::PNG));
+    formats.append(qMakePair(QStringLiteral("OBJ"), LayoutExportFormat::OBJ));
+    formats.append(qMakePair(QStringLiteral("DXF flat"), LayoutExportFormat::DXF_AC1015_Flat));
+    formats.append(qMakePair(QStringLiteral("DXF AAMA"), LayoutExportFormat::DXF_AC1015_AAMA));
+    formats.append(qMakePair(QStringLiteral("DXF ASTM"), LayoutExportFormat::DXF_AC1015_ASTM));
+
+    for (int i = 0; i < files.size(); ++i)
+    {
+        for (int j = 0; j < formats.size(); ++j)
+        {
+            const QString tag = QStringLiteral("%1, %2").arg(files.at(i), formats.at(j).first);
+            QTest::newRow(qUtf8Printable(tag)) << files.at(i) << static_cast<int>(formats.at(j).second);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ExportEndToEnd measures whole export mode: process start, parse, layout nesting and writing the file.
+ */
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::ExportEndToEnd()
+{
+    QFETCH(QString, file);
+    QFETCH(int, format);
+
+    const QStringList arguments = QStringList() << TmpPath() + file
+                                                << QStringLiteral("-p") << QStringLiteral("0")
+                                                << QStringLiteral("-d") << TmpPath()
+                                                << QStringLiteral("-b") << QStringLiteral("output")
+                                                << QStringLiteral("-f") << QString::number(format);
+
+    int exit = V_EX_OK;
+    QString error;
+    QBENCHMARK
+    {
+        exit = Run(V_EX_OK, Seamly2DPath(), arguments, error, 600000);
+    }
+
+    QVERIFY2(exit == V_EX_OK, qUtf8Printable(error));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_PatternBenchmark::cleanupTestCase()
+{
+    QDir tmpDir(TmpPath());
+    tmpDir.removeRecursively();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_PatternBenchmark::AddPatternRows() const
+{
+    QTest::addColumn<QString>("file");
+
+    QTest::newRow("Issue #372") << QStringLiteral("issue_372.val");
+    QTest::newRow("TestDart") << QStringLiteral("TestDart.val");
+    QTest::newRow("TShirt_test") << QStringLiteral("TShirt_test.val");
+    QTest::newRow("Synthetic small") << QStringLiteral("synthetic_small.val");
+    QTest::newRow("Synthetic medium") << QStringLiteral("synthetic_medium.val");
+    QTest::newRow("Synthetic large") << QStringLiteral("synthetic_large.val");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_PatternBenchmark::AddSyntheticRows() const
+{
+    QTest::addColumn<QString>("file");
+
+    QTest::newRow("Synthetic small") << QStringLiteral("synthetic_small.val");
+    QTest::newRow("Synthetic medium") << QStringLiteral("synthetic_medium.val");
+    QTest::newRow("Synthetic large") << QStringLiteral("synthetic_large.val");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief OpenPattern open pattern in the main window the same way as user does. Previous pattern is closed first,
+ * otherwise main window would start a new Seamly2D instance.
+ * @param fileName pattern file.
+ * @return opened pattern, nullptr if main window failed to open the file.
+ */
+VPattern *TST_PatternBenchmark::OpenPattern(const QString &fileName)
+{
+    MainWindow *window = qobject_cast<MainWindow *>(qApp->getMainWindow());
+    SCASSERT(window != nullptr)
+
+    QMetaObject::invokeMethod(window, "Clear", Qt::DirectConnection);
+    if (not window->LoadPattern(fileName))
+    {
+        return nullptr;
+    }
+
+    return qobject_cast<VPattern *>(qApp->getCurrentDocument());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PreparePieces create layout pieces for all pieces of opened pattern. Each piece takes data from its tool, like
+ * main window does before layout.
+ * @param doc opened pattern.
+ * @return layout pieces.
+ */
+QVector<VLayoutPiece> TST_PatternBenchmark::PreparePieces(const VPattern *doc)
+{
+    QVector<VLayoutPiece> pieces;
+    const QDomNodeList nodes = doc->elementsByTagName(VAbstractPattern::TagPiece);
+    for (int i = 0; i < nodes.size(); ++i)
+    {
+        const QDomElement element = nodes.at(i).toElement();
+        const quint32 id = VDomDocument::GetParametrUInt(element, VDomDocument::AttrId, NULL_ID_STR);
+
+        VAbstractTool *tool = qobject_cast<VAbstractTool*>(VAbstractPattern::getTool(id));
+        SCASSERT(tool != nullptr)
+        pieces.append(VLayoutPiece::Create(tool->getData()->GetPiece(id), tool->getData()));
+    }
+
+    return pieces;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GenerateSyntheticPattern write pattern with one draft block per piece.
+ *
+ * Each block has a chain of draft tools whose lengths depend on previous lines, and a piece made of the base point and
+ * a closed spline path through curve nodes placed on a circle.
+ *
+ * @param fileName output file.
+ * @param tools total number of draft tools in the chains.
+ * @param pieces number of pieces (and draft blocks).
+ * @param curveNodes number of nodes in each piece curve.
+ * @return true if all is good.
+ */
+bool TST_PatternBenchmark::GenerateSyntheticPattern(const QString &fileName, int tools, int pieces, int curveNodes)
+{
+    QFile file(fileName);
+    if (not file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    pieces = qMax(pieces, 1);
+    curveNodes = qMax(curveNodes, 3);
+    const int toolsPerBlock = qMax(tools / pieces, 0);
+
+    QXmlStreamWriter stream(&file);
+    stream.setAutoFormatting(true);
+    stream.writeStartDocument();
+    stream.writeStartElement(QStringLiteral("pattern"));
+    stream.writeComment(QStringLiteral("Synthetic pattern for benchmarks."));
+    stream.writeTextElement(QStringLiteral("version"), QStringLiteral("0.2.4"));
+    stream.writeTextElement(QStringLiteral("unit"), QStringLiteral("cm"));
+    stream.writeEmptyElement(QStringLiteral("author"));
+    stream.writeEmptyElement(QStringLiteral("description"));
+    stream.writeEmptyElement(QStringLiteral("notes"));
+    stream.writeEmptyElement(QStringLiteral("measurements"));
+    stream.writeEmptyElement(QStringLiteral("increments"));
+
+    quint32 id = 0;
+    for (int p = 0; p < pieces; ++p)
+    {
+        const QString prefix = QStringLiteral("B%1").arg(p);
+
+        stream.writeStartElement(QStringLiteral("draw"));
+        stream.writeAttribute(QStringLiteral("name"), QStringLiteral("Block %1").arg(p));
+
+        stream.writeStartElement(QStringLiteral("calculation"));
+
+        const quint32 baseId = ++id;
+        const QString baseName = prefix + QLatin1String("O");
+        stream.writeEmptyElement(QStringLiteral("point"));
+        stream.writeAttribute(QStringLiteral("type"), QStringLiteral("single"));
+        stream.writeAttribute(QStringLiteral("x"), QString::number(p * 30));
+        stream.writeAttribute(QStringLiteral("y"), QStringLiteral("0"));
+        stream.writeAttribute(QStringLiteral("id"), QString::number(baseId));
+        stream.writeAttribute(QStringLiteral("name"), baseName);
+        WriteLabelPosition(stream);
+
+        // Chain of tools. Each length refers to the previous line, so parser has to resolve variables.
+        QString beforePrevious;
+        QString previous = baseName;
+        quint32 previousId = baseId;
+        for (int i = 0; i < toolsPerBlock; ++i)
+        {
+            const QString name = prefix + QLatin1String("T") + QString::number(i);
+            const QString length = beforePrevious.isEmpty() ? QStringLiteral("1")
+                                                            : QStringLiteral("Line_%1_%2*0.9+0.5")
+                                                              .arg(beforePrevious, previous);
+            WriteEndLine(stream, ++id, name, previousId, (i * 37) % 360, length, QStringLiteral("hair"));
+
+            beforePrevious = previous;
+            previous = name;
+            previousId = id;
+        }
+
+        // Curve nodes on a circle around the base point
+        QVector<quint32> nodes;
+        nodes.reserve(curveNodes);
+        for (int k = 0; k < curveNodes; ++k)
+        {
+            const qreal angle = 360.0 * k / curveNodes;
+            WriteEndLine(stream, ++id, prefix + QLatin1String("C") + QString::number(k), baseId, angle,
+                         QStringLiteral("10"), QStringLiteral("none"));
+            nodes.append(id);
+        }
+
+        const quint32 pathId = ++id;
+        stream.writeStartElement(QStringLiteral("spline"));
+        stream.writeAttribute(QStringLiteral("type"), QStringLiteral("path"));
+        stream.writeAttribute(QStringLiteral("id"), QString::number(pathId));
+        stream.writeAttribute(QStringLiteral("kCurve"), QStringLiteral("1"));
+        for (int k = 0; k < nodes.size(); ++k)
+        {
+            const qreal tangent = 360.0 * k / curveNodes + 90;
+            stream.writeEmptyElement(QStringLiteral("pathPoint"));
+            stream.writeAttribute(QStringLiteral("kAsm1"), QStringLiteral("1"));
+            stream.writeAttribute(QStringLiteral("kAsm2"), QStringLiteral("1"));
+            stream.writeAttribute(QStringLiteral("pSpline"), QString::number(nodes.at(k)));
+            stream.writeAttribute(QStringLiteral("angle"), QString::number(tangent > 360 ? tangent - 360 : tangent));
+        }
+        stream.writeEndElement(); // spline
+
+        stream.writeEndElement(); // calculation
+
+        stream.writeStartElement(QStringLiteral("modeling"));
+        const quint32 modelingBaseId = ++id;
+        stream.writeEmptyElement(QStringLiteral("point"));
+        stream.writeAttribute(QStringLiteral("type"), QStringLiteral("modeling"));
+        stream.writeAttribute(QStringLiteral("inUse"), QStringLiteral("true"));
+        stream.writeAttribute(QStringLiteral("id"), QString::number(modelingBaseId));
+        stream.writeAttribute(QStringLiteral("idObject"), QString::number(baseId));
+        WriteLabelPosition(stream);
+
+        const quint32 modelingPathId = ++id;
+        stream.writeEmptyElement(QStringLiteral("spline"));
+        stream.writeAttribute(QStringLiteral("type"), QStringLiteral("modelingPath"));
+        stream.writeAttribute(QStringLiteral("inUse"), QStringLiteral("true"));
+        stream.writeAttribute(QStringLiteral("id"), QString::number(modelingPathId));
+        stream.writeAttribute(QStringLiteral("idObject"), QString::number(pathId));
+        stream.writeEndElement(); // modeling
+
+        stream.writeStartElement(QStringLiteral("details"));
+        stream.writeStartElement(QStringLiteral("detail"));
+        stream.writeAttribute(QStringLiteral("closed"), QStringLiteral("1"));
+        stream.writeAttribute(QStringLiteral("name"), QStringLiteral("Piece %1").arg(p));
+        stream.writeAttribute(QStringLiteral("id"), QString::number(++id));
+        stream.writeAttribute(QStringLiteral("supplement"), QStringLiteral("1"));
+        stream.writeAttribute(QStringLiteral("width"), QStringLiteral("1"));
+        stream.writeAttribute(QStringLiteral("mx"), QStringLiteral("0"));
+        stream.writeAttribute(QStringLiteral("my"), QStringLiteral("0"));
+
+        stream.writeEmptyElement(QStringLiteral("node"));
+        stream.writeAttribute(QStringLiteral("type"), QStringLiteral("NodePoint"));
+        stream.writeAttribute(QStringLiteral("nodeType"), QStringLiteral("Contour"));
+        stream.writeAttribute(QStringLiteral("idObject"), QString::number(modelingBaseId));
+        stream.writeAttribute(QStringLiteral("mx"), QStringLiteral("0"));
+        stream.writeAttribute(QStringLiteral("my"), QStringLiteral("0"));
+
+        stream.writeEmptyElement(QStringLiteral("node"));
+        stream.writeAttribute(QStringLiteral("type"), QStringLiteral("NodeSplinePath"));
+        stream.writeAttribute(QStringLiteral("reverse"), QStringLiteral("0"));
+        stream.writeAttribute(QStringLiteral("nodeType"), QStringLiteral("Contour"));
+        stream.writeAttribute(QStringLiteral("idObject"), QString::number(modelingPathId));
+        stream.writeAttribute(QStringLiteral("mx"), QStringLiteral("0"));
+        stream.writeAttribute(QStringLiteral("my"), QStringLiteral("0"));
+
+        stream.writeEndElement(); // detail
+        stream.writeEndElement(); // details
+
+        stream.writeEndElement(); // draw
+    }
+
+    stream.writeEndElement(); // pattern
+    stream.writeEndDocument();
+
+    return not stream.hasError();
+}
@@ -0,0 +1,80 @@
+/***************************************************************************
+ **  @file   tst_patternbenchmark.h
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#ifndef TST_PATTERNBENCHMARK_H
+#define TST_PATTERNBENCHMARK_H
+
+#include "../vtest/abstracttest.h"
+
+#include <QObject>
+#include <QString>
+#include <QVector>
+
+class VLayoutPiece;
+class VPattern;
+
+/**
+ * @brief The TST_PatternBenchmark class measures the speed of pattern loading, parsing, layout and export.
+ *
+ * Besides files from the collection it generates synthetic patterns of growing size: N draft tools, M pieces and K
+ * curve nodes per piece.
+ *
+ * Parse and layout benchmarks run in process on a pattern opened in the main window. Functions with "EndToEnd" suffix
+ * run seamly2d binary, so they also include process start, conversion and writing files.
+ */
+class TST_PatternBenchmark : public AbstractTest
+{
+    Q_OBJECT
+public:
+    explicit TST_PatternBenchmark(QObject *parent = nullptr);
+
+private slots:
+    void initTestCase();
+    void ConvertPattern_data() const;
+    void ConvertPattern();
+    void FullParse_data() const;
+    void FullParse();
+    void LiteParse_data() const;
+    void LiteParse();
+    void SeamAllowance_data() const;
+    void SeamAllowance();
+    void LayoutGenerate_data() const;
+    void LayoutGenerate();
+    void OpenEndToEnd_data() const;
+    void OpenEndToEnd();
+    void ExportEndToEnd_data() const;
+    void ExportEndToEnd();
+    void cleanupTestCase();
+
+private:
+    Q_DISABLE_COPY(TST_PatternBenchmark)
+
+    void AddPatternRows() const;
+    void AddSyntheticRows() const;
+    static VPattern *OpenPattern(const QString &fileName);
+    static QVector<VLayoutPiece> PreparePieces(const VPattern *doc);
+    static bool GenerateSyntheticPattern(const QString &fileName, int tools, int pieces, int curveNodes);
+};
+
+#endif // TST_PATTERNBENCHMARK_H
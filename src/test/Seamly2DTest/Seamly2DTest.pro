@@ -30,6 +30,10 @@ DEFINES += SRCDIR=\\\"$$PWD/\\\"
 SOURCES += \
     qttestmainlambda.cpp \
     tst_vposter.cpp \
+    tst_vcurveintersection.cpp \
+    tst_vgroupindex.cpp \
+    tst_vdomdocument.cpp \
+    tst_vscenedisplaylist.cpp \
     tst_vspline.cpp \
     tst_nameregexp.cpp \
     tst_vlayoutdetail.cpp \
@@ -49,12 +53,17 @@ SOURCES += \
     tst_vpointf.cpp \
     tst_readval.cpp \
     tst_vtranslatevars.cpp \
+    tst_calculator.cpp \
     tst_vabstractpiece.cpp
 
 *msvc*:SOURCES += stable.cpp
 
 HEADERS += \
     tst_vposter.h \
+    tst_vcurveintersection.h \
+    tst_vgroupindex.h \
+    tst_vdomdocument.h \
+    tst_vscenedisplaylist.h \
     tst_vspline.h \
     tst_nameregexp.h \
     tst_vlayoutdetail.h \
@@ -75,6 +84,7 @@ HEADERS += \
     tst_vpointf.h \
     tst_readval.h \
     tst_vtranslatevars.h \
+    tst_calculator.h \
     tst_vabstractpiece.h
 
 include(warnings.pri)
@@ -52,6 +52,7 @@
 #include <QtTest>
 
 #include "tst_vposter.h"
+#include "tst_vscenedisplaylist.h"
 #include "tst_vabstractpiece.h"
 #include "tst_vspline.h"
 #include "tst_nameregexp.h"
@@ -66,12 +67,16 @@
 #include "tst_vpiece.h"
 #include "tst_findpoint.h"
 #include "tst_vabstractcurve.h"
+#include "tst_vcurveintersection.h"
+#include "tst_vgroupindex.h"
+#include "tst_vdomdocument.h"
 #include "tst_vcubicbezierpath.h"
 #include "tst_vgobject.h"
 #include "tst_vsplinepath.h"
 #include "tst_vpointf.h"
 #include "tst_readval.h"
 #include "tst_vtranslatevars.h"
+#include "tst_calculator.h"
 
 #include "../vmisc/def.h"
 #include "../qmuparser/qmudef.h"
@@ -141,6 +146,7 @@ int main(int argc, char** argv)
     ASSERT_TEST(new TST_FindPoint());
     ASSERT_TEST(new TST_VPiece());
     ASSERT_TEST(new TST_VPoster());
+    ASSERT_TEST(new TST_VSceneDisplayList());
     ASSERT_TEST(new TST_VAbstractPiece());
     ASSERT_TEST(new TST_VSpline());
     ASSERT_TEST(new TST_VSplinePath());
@@ -154,11 +160,15 @@ int main(int argc, char** argv)
     ASSERT_TEST(new TST_Misc());
     ASSERT_TEST(new TST_VCommandLine());
     ASSERT_TEST(new TST_VAbstractCurve());
+    ASSERT_TEST(new TST_VCurveIntersection());
+    ASSERT_TEST(new TST_VGroupIndex());
+    ASSERT_TEST(new TST_VDomDocument());
     ASSERT_TEST(new TST_VCubicBezierPath());
     ASSERT_TEST(new TST_VGObject());
     ASSERT_TEST(new TST_VPointF());
     ASSERT_TEST(new TST_ReadVal());
     ASSERT_TEST(new TST_VTranslateVars());
+    ASSERT_TEST(new TST_Calculator());
 
     return status;
 }
@@ -0,0 +1,94 @@
+/***************************************************************************
+ **  @file   tst_calculator.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "tst_calculator.h"
+#include "../vpatterndb/calculator.h"
+#include "../vpatterndb/variables/measurement_variable.h"
+
+#include <QtTest>
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_Calculator::TST_Calculator(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Calculator::TestEvalFormulaBulk_data()
+{
+    QTest::addColumn<QString>("formula");
+
+    QTest::newRow("Only numbers") << QString("2+3*4");
+    QTest::newRow("One measurement") << QString("a");
+    QTest::newRow("Two measurements") << QString("a*2+b/4-3");
+    QTest::newRow("Functions") << QString("sqrt(a)+max(a;b)");
+    QTest::newRow("Unary minus") << QString("-a+b");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Bulk evaluation must give the same results as evaluation of each size and height separately.
+void TST_Calculator::TestEvalFormulaBulk()
+{
+    QFETCH(QString, formula);
+
+    const Unit unit = Unit::Cm;
+    qreal size = 50;
+    qreal height = 176;
+
+    QHash<QString, QSharedPointer<VInternalVariable> > vars;
+
+    auto AddMeasurement = [&vars, &size, &height, &unit](const QString &name, qreal base, qreal ksize,
+                                                        qreal kheight)
+    {
+        QSharedPointer<MeasurementVariable> m(new MeasurementVariable(0, name, 50, 176, base, ksize, kheight));
+        m->setSize(&size);
+        m->setHeight(&height);
+        m->SetUnit(&unit);
+        vars.insert(name, m);
+    };
+
+    AddMeasurement("a", 100, 4, 1);
+    AddMeasurement("b", 40, 1.5, 0.5);
+
+    const QVector<qreal> sizes = QVector<qreal>() << 44 << 46 << 48 << 50 << 52 << 54 << 56;
+    const QVector<qreal> heights = QVector<qreal>() << 164 << 170 << 176 << 176 << 182 << 188 << 194;
+
+    QHash<QString, QVector<qreal> > columns;
+    columns.insert("a", qSharedPointerDynamicCast<MeasurementVariable>(vars.value("a"))->gradedValues(sizes, heights));
+    columns.insert("b", qSharedPointerDynamicCast<MeasurementVariable>(vars.value("b"))->gradedValues(sizes, heights));
+
+    Calculator bulk;
+    const QVector<qreal> results = bulk.EvalFormulaBulk(&vars, formula, columns, sizes.size());
+    QCOMPARE(results.size(), sizes.size());
+
+    for (int i = 0; i < sizes.size(); ++i)
+    {
+        size = sizes.at(i);
+        height = heights.at(i);
+
+        Calculator cal;
+        const qreal expected = cal.EvalFormula(&vars, formula);
+        QCOMPARE(results.at(i), expected);
+    }
+}
@@ -241,3 +241,41 @@ void TST_Misc::TestIssue485()
     const int res = VGObject::LineIntersectCircle(QPointF(), radius, QLineF(QPointF(), sPoint-cPoint), p1, p2);
     QCOMPARE(res, 0);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Misc::TestUnitFactor_data()
+{
+    QTest::addColumn<int>("from");
+    QTest::addColumn<int>("to");
+
+    const QVector<Unit> units = {Unit::Mm, Unit::Cm, Unit::Inch, Unit::Px};
+    for (auto from : units)
+    {
+        for (auto to : units)
+        {
+            QTest::newRow(qUtf8Printable(UnitsToStr(from) + QLatin1String("->") + UnitsToStr(to)))
+                    << static_cast<int>(from) << static_cast<int>(to);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Factor must give the same result as scalar conversion
+void TST_Misc::TestUnitFactor()
+{
+    QFETCH(int, from);
+    QFETCH(int, to);
+
+    const Unit fromUnit = static_cast<Unit>(from);
+    const Unit toUnit = static_cast<Unit>(to);
+    const qreal value = 123.45;
+
+    QVERIFY(qFuzzyCompare(value * UnitFactor(fromUnit, toUnit), UnitConvertor(value, fromUnit, toUnit)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Misc::TestMapPoints()
+{
+    const QVector<QPointF> mapped = MapPoints(QVector<QPointF>({QPointF(1, 2), QPointF(-3, 4)}), 2, -2, 1, 10);
+    QCOMPARE(mapped, QVector<QPointF>({QPointF(3, 6), QPointF(-5, 2)}));
+}
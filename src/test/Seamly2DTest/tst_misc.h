@@ -72,6 +72,11 @@ private slots:
 
     void TestIssue485();
 
+    void TestUnitFactor_data();
+    void TestUnitFactor();
+
+    void TestMapPoints();
+
 private:
     Q_DISABLE_COPY(TST_Misc)
 };
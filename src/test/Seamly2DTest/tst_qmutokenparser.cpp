@@ -84,6 +84,9 @@ void TST_QmuTokenParser::IsSingle_data()
     QTest::newRow("Correct C locale 15500.1") << "15500.1" << true;
     QTest::newRow("Not C locale 15,5") << "15,5" << false;
     QTest::newRow("Not C locale 15.500,1") << "15.500,1" << false;
+    QTest::newRow("Negative value with decimal part") << "-15.5" << true;
+    QTest::newRow("Two decimal points") << "15.5.5" << false;
+    QTest::newRow("Number and variable name") << "15a" << false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
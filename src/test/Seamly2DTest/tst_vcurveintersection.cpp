@@ -0,0 +1,133 @@
+/***************************************************************************
+ **  @file   tst_vcurveintersection.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "tst_vcurveintersection.h"
+#include "../vgeometry/vabstractcurve.h"
+#include "../vgeometry/vcurveintersection.h"
+
+#include <QtMath>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> Wave(int points, qreal amplitude, qreal periods, qreal shift)
+{
+    QVector<QPointF> wave;
+    wave.reserve(points);
+    for (int i = 0; i < points; ++i)
+    {
+        const qreal x = 1000.0 * i / qMax(points - 1, 1);
+        wave.append(QPointF(x, shift + amplitude * qSin(2 * M_PI * periods * x / 1000.0)));
+    }
+    return wave;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> Circle(int points, const QPointF &center, qreal radius)
+{
+    QVector<QPointF> circle;
+    circle.reserve(points + 1);
+    for (int i = 0; i <= points; ++i)
+    {
+        const qreal angle = 2 * M_PI * i / points;
+        circle.append(center + QPointF(radius * qCos(angle), radius * qSin(angle)));
+    }
+    return circle;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// The sweep VToolPointOfIntersectionCurves::FindPoint used before
+QVector<QPointF> SweepIntersections(const QVector<QPointF> &curve1, const QVector<QPointF> &curve2)
+{
+    QVector<QPointF> intersections;
+    for (int i = 0; i < curve1.count()-1; ++i)
+    {
+        intersections << VAbstractCurve::CurveIntersectLine(curve2, QLineF(curve1.at(i), curve1.at(i+1)));
+    }
+    return intersections;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VCurveIntersection::TST_VCurveIntersection(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VCurveIntersection::IntersectCurve_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("curve1");
+    QTest::addColumn<QVector<QPointF>>("curve2");
+
+    QTest::newRow("Empty curve") << QVector<QPointF>() << Wave(100, 50, 3, 0);
+    QTest::newRow("Single point") << (QVector<QPointF>() << QPointF(10, 10)) << Wave(100, 50, 3, 0);
+    QTest::newRow("Two segments") << (QVector<QPointF>() << QPointF(0, 0) << QPointF(100, 100))
+                                  << (QVector<QPointF>() << QPointF(0, 100) << QPointF(100, 0));
+    QTest::newRow("Touch in the end point") << (QVector<QPointF>() << QPointF(0, 0) << QPointF(100, 100))
+                                            << (QVector<QPointF>() << QPointF(100, 100) << QPointF(200, 0));
+    QTest::newRow("Waves without intersections") << Wave(500, 50, 3, 0) << Wave(700, 50, 3, 200);
+    QTest::newRow("Crossed waves") << Wave(500, 50, 3, 0) << Wave(700, 80, 5, 10);
+    QTest::newRow("Wave and circle") << Wave(1000, 300, 2, 0) << Circle(800, QPointF(500, 0), 250);
+    QTest::newRow("Circles") << Circle(600, QPointF(0, 0), 200) << Circle(900, QPointF(150, 50), 220);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VCurveIntersection::IntersectCurve() const
+{
+    QFETCH(QVector<QPointF>, curve1);
+    QFETCH(QVector<QPointF>, curve2);
+
+    QCOMPARE(VCurveIntersection::CurvesIntersections(curve1, curve2), SweepIntersections(curve1, curve2));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VCurveIntersection::IntersectLine_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("curve");
+    QTest::addColumn<QLineF>("line");
+
+    QTest::newRow("Empty curve") << QVector<QPointF>() << QLineF(0, 0, 100, 100);
+    QTest::newRow("Vertical line") << Wave(500, 50, 3, 0) << QLineF(333, -1000, 333, 1000);
+    QTest::newRow("Horizontal line") << Wave(500, 50, 3, 0) << QLineF(-100, 10, 1100, 10);
+    QTest::newRow("Long ray") << Circle(800, QPointF(500, 0), 250) << QLineF(500, 0, 1e9, 1e9);
+    QTest::newRow("Line through a vertex") << (QVector<QPointF>() << QPointF(0, 0) << QPointF(50, 50)
+                                                                  << QPointF(100, 0))
+                                           << QLineF(50, 100, 50, -100);
+    QTest::newRow("No intersections") << Wave(500, 50, 3, 0) << QLineF(0, 500, 1000, 600);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VCurveIntersection::IntersectLine() const
+{
+    QFETCH(QVector<QPointF>, curve);
+    QFETCH(QLineF, line);
+
+    QCOMPARE(VCurveIntersection(curve).IntersectLine(line), VAbstractCurve::CurveIntersectLine(curve, line));
+}
@@ -0,0 +1,184 @@
+/***************************************************************************
+ **  @file   tst_vdomdocument.cpp
+ **  @date   Oct 19, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vdomdocument.h"
+#include "../ifc/xml/vdomdocument.h"
+
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+// Reference writer, the way canonical XML was written before attributes were sorted through reusable buffers.
+void ReferenceSaveNode(QXmlStreamWriter &stream, const QDomNode &domNode)
+{
+    if (domNode.isElement())
+    {
+        const QDomElement domElement = domNode.toElement();
+        stream.writeStartElement(domElement.tagName());
+
+        QMap<QString, QString> attributes;
+        const QDomNamedNodeMap attributeMap = domElement.attributes();
+        for (int i = 0; i < attributeMap.count(); ++i)
+        {
+            const QDomNode attribute = attributeMap.item(i);
+            attributes.insert(attribute.nodeName(), attribute.nodeValue());
+        }
+
+        QMap<QString, QString>::const_iterator i = attributes.constBegin();
+        while (i != attributes.constEnd())
+        {
+            stream.writeAttribute(i.key(), i.value());
+            ++i;
+        }
+
+        QDomNode elementChild = domElement.firstChild();
+        while (not elementChild.isNull())
+        {
+            ReferenceSaveNode(stream, elementChild);
+            elementChild = elementChild.nextSibling();
+        }
+
+        stream.writeEndElement();
+    }
+    else if (domNode.isComment())
+    {
+        stream.writeComment(domNode.nodeValue());
+    }
+    else if (domNode.isText())
+    {
+        stream.writeCharacters(domNode.nodeValue());
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray ReferenceCanonicalXML(const QDomDocument &document, int indent)
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    QXmlStreamWriter stream(&buffer);
+    stream.setAutoFormatting(true);
+    stream.setAutoFormattingIndent(indent);
+    stream.writeStartDocument();
+
+    QDomNode root = document.documentElement();
+    while (not root.isNull())
+    {
+        ReferenceSaveNode(stream, root);
+        root = root.nextSibling();
+    }
+
+    stream.writeEndDocument();
+    return buffer.data();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void CompareWriters(const QDomDocument &document)
+{
+    const int indent = 4;
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+
+    QString error;
+    QVERIFY2(VDomDocument::SaveCanonicalXML(document, &buffer, indent, error), qUtf8Printable(error));
+    QCOMPARE(buffer.data(), ReferenceCanonicalXML(document, indent));
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VDomDocument::TST_VDomDocument(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VDomDocument::SaveCanonicalXMLCollection_data() const
+{
+    QTest::addColumn<QString>("fileName");
+
+    const QString collection = QStringLiteral(SRCDIR) + QStringLiteral("../../app/share/collection");
+    const QStringList filters = QStringList() << QStringLiteral("*.val") << QStringLiteral("*.vit")
+                                              << QStringLiteral("*.vst");
+
+    QDirIterator it(collection, filters, QDir::Files, QDirIterator::Subdirectories);
+    int count = 0;
+    while (it.hasNext())
+    {
+        const QString fileName = it.next();
+        QTest::newRow(qUtf8Printable(QDir(collection).relativeFilePath(fileName))) << fileName;
+        ++count;
+    }
+
+    QVERIFY2(count > 0, qUtf8Printable(QStringLiteral("No files found in %1").arg(collection)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VDomDocument::SaveCanonicalXMLCollection() const
+{
+    QFETCH(QString, fileName);
+
+    QFile file(fileName);
+    QVERIFY2(file.open(QIODevice::ReadOnly), qUtf8Printable(file.errorString()));
+
+    QDomDocument document;
+    QString errorMsg;
+    int errorLine = -1;
+    int errorColumn = -1;
+    QVERIFY2(document.setContent(&file, &errorMsg, &errorLine, &errorColumn),
+             qUtf8Printable(QStringLiteral("%1 (%2:%3)").arg(errorMsg).arg(errorLine).arg(errorColumn)));
+
+    CompareWriters(document);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VDomDocument::SaveCanonicalXMLEscaping_data() const
+{
+    QTest::addColumn<QString>("content");
+
+    QTest::newRow("Attribute escaping")
+            << QStringLiteral("<pattern b=\"&lt;a&gt; &amp; &quot;b&quot; 'c'\" a=\"line&#10;tab&#9;end\"/>");
+    QTest::newRow("Text escaping")
+            << QStringLiteral("<pattern><notes>a &lt; b &amp;&amp; c &gt; d</notes></pattern>");
+    QTest::newRow("Empty elements")
+            << QStringLiteral("<pattern><empty/><alsoEmpty></alsoEmpty><point z=\"1\" y=\"2\" x=\"3\"/></pattern>");
+    QTest::newRow("Comments and unicode")
+            << QStringLiteral("<pattern><!-- comment --><name>&#1042;&#1080;&#1082;&#1088;&#1086;&#1081;&#1082;&#1072;"
+                              "</name></pattern>");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VDomDocument::SaveCanonicalXMLEscaping() const
+{
+    QFETCH(QString, content);
+
+    QDomDocument document;
+    QVERIFY(document.setContent(content));
+
+    CompareWriters(document);
+}
@@ -0,0 +1,45 @@
+/***************************************************************************
+ **  @file   tst_vdomdocument.h
+ **  @date   Oct 19, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef TST_VDOMDOCUMENT_H
+#define TST_VDOMDOCUMENT_H
+
+#include <QObject>
+
+class TST_VDomDocument : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TST_VDomDocument(QObject *parent = nullptr);
+
+private slots:
+    void SaveCanonicalXMLCollection_data() const;
+    void SaveCanonicalXMLCollection() const;
+    void SaveCanonicalXMLEscaping_data() const;
+    void SaveCanonicalXMLEscaping() const;
+
+private:
+    Q_DISABLE_COPY(TST_VDomDocument)
+};
+
+#endif // TST_VDOMDOCUMENT_H
@@ -0,0 +1,96 @@
+/***************************************************************************
+ **  @file   tst_vgroupindex.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+
+#include "tst_vgroupindex.h"
+#include "../ifc/xml/vgroupindex.h"
+
+#include <QtTest>
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VGroupIndex::TST_VGroupIndex(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGroupIndex::AddItems() const
+{
+    VGroupIndex index;
+    index.AddGroup(10);
+    index.AddGroup(5);
+    index.AddItem(5, 1, 1);
+    index.AddItem(5, 2, 3);
+    index.AddItem(7, 1, 1);
+    index.AddItem(7, 1, 1); // Adding twice has no effect
+
+    QCOMPARE(index.Groups(), QVector<quint32>({5, 7, 10}));
+    QCOMPARE(index.GroupsOf(1, 1), QVector<quint32>({5, 7}));
+    QCOMPARE(index.GroupsOf(2, 3), QVector<quint32>({5}));
+    QVERIFY(index.GroupsOf(3, 2).isEmpty());
+    QCOMPARE(index.Items(7), QVector<QPair<quint32, quint32> >({qMakePair(1u, 1u)}));
+    QVERIFY(index.Items(10).isEmpty());
+    QVERIFY(index.Contains(5, 2, 3));
+    QVERIFY(not index.Contains(10, 2, 3));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGroupIndex::RemoveItem() const
+{
+    VGroupIndex index;
+    index.AddItem(5, 1, 1);
+    index.AddItem(7, 1, 1);
+
+    index.RemoveItem(5, 1, 1);
+    QCOMPARE(index.GroupsOf(1, 1), QVector<quint32>({7}));
+    QVERIFY(index.Items(5).isEmpty());
+    QCOMPARE(index.Groups(), QVector<quint32>({5, 7}));
+
+    index.RemoveItem(7, 1, 1);
+    QVERIFY(index.GroupsOf(1, 1).isEmpty());
+
+    index.RemoveItem(9, 1, 1); // Unknown group
+    QCOMPARE(index.Groups(), QVector<quint32>({5, 7}));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGroupIndex::RemoveGroup() const
+{
+    VGroupIndex index;
+    index.AddItem(5, 1, 1);
+    index.AddItem(5, 2, 2);
+    index.AddItem(7, 2, 2);
+
+    index.RemoveGroup(5);
+    QCOMPARE(index.Groups(), QVector<quint32>({7}));
+    QVERIFY(index.GroupsOf(1, 1).isEmpty());
+    QCOMPARE(index.GroupsOf(2, 2), QVector<quint32>({7}));
+
+    index.Clear();
+    QVERIFY(index.Groups().isEmpty());
+    QVERIFY(index.GroupsOf(2, 2).isEmpty());
+}
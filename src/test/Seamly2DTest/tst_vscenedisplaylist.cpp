@@ -0,0 +1,141 @@
+/***************************************************************************
+ **  @file   tst_vscenedisplaylist.cpp
+ **  @date   Oct 18, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+
+#include "tst_vscenedisplaylist.h"
+#include "../vlayout/vscenedisplaylist.h"
+
+#include <QGraphicsEllipseItem>
+#include <QGraphicsRectItem>
+#include <QGraphicsScene>
+#include <QImage>
+#include <QPainter>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+void FillScene(QGraphicsScene &scene)
+{
+    scene.addRect(QRectF(0, 0, 400, 300), QPen(Qt::NoPen), QBrush(Qt::white)); // paper
+
+    auto *rect = scene.addRect(QRectF(20, 20, 150, 100), QPen(Qt::black, 3), QBrush(Qt::yellow));
+    rect->setRotation(15);
+
+    auto *child = new QGraphicsEllipseItem(QRectF(10, 10, 40, 40), rect);
+    child->setBrush(QBrush(Qt::blue));
+
+    auto *behind = new QGraphicsEllipseItem(QRectF(-10, -10, 60, 30), rect);
+    behind->setBrush(QBrush(Qt::green));
+    behind->setFlag(QGraphicsItem::ItemStacksBehindParent);
+
+    QPainterPath path;
+    path.moveTo(200, 50);
+    path.cubicTo(300, 0, 250, 250, 380, 280);
+    scene.addPath(path, QPen(Qt::red, 5));
+
+    auto *transparent = scene.addEllipse(QRectF(150, 150, 120, 120), QPen(Qt::black), QBrush(Qt::magenta));
+    transparent->setOpacity(0.5);
+
+    auto *hidden = scene.addRect(QRectF(0, 0, 400, 300), QPen(Qt::NoPen), QBrush(Qt::black));
+    hidden->setVisible(false);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QImage EmptyImage()
+{
+    QImage image(200, 150, QImage::Format_ARGB32);
+    image.fill(Qt::white);
+    return image;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VSceneDisplayList::TST_VSceneDisplayList(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VSceneDisplayList::RenderTile_data() const
+{
+    QTest::addColumn<QRectF>("source");
+
+    QTest::newRow("Whole sheet") << QRectF(0, 0, 400, 300);
+    QTest::newRow("Top left") << QRectF(0, 0, 200, 150);
+    QTest::newRow("Top right") << QRectF(200, 0, 200, 150);
+    QTest::newRow("Bottom left") << QRectF(0, 150, 200, 150);
+    QTest::newRow("Bottom right") << QRectF(200, 150, 200, 150);
+    QTest::newRow("Center") << QRectF(100, 75, 200, 150);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RenderTile checks that replaying a tile gives the same picture as rendering the scene.
+ */
+// cppcheck-suppress unusedFunction
+void TST_VSceneDisplayList::RenderTile() const
+{
+    QFETCH(QRectF, source);
+
+    QGraphicsScene scene;
+    FillScene(scene);
+
+    VSceneDisplayList list;
+    list.Record(&scene);
+    QVERIFY(not list.IsEmpty());
+
+    QImage expected = EmptyImage();
+    {
+        QPainter painter(&expected);
+        scene.render(&painter, expected.rect(), source, Qt::IgnoreAspectRatio);
+    }
+
+    QImage result = EmptyImage();
+    {
+        QPainter painter(&result);
+        list.Render(&painter, result.rect(), source);
+    }
+
+    QCOMPARE(result, expected);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VSceneDisplayList::EmptyTile() const
+{
+    QGraphicsScene scene;
+    FillScene(scene);
+
+    VSceneDisplayList list;
+    list.Record(&scene);
+
+    QImage result = EmptyImage();
+    {
+        QPainter painter(&result);
+        list.Render(&painter, result.rect(), QRectF(1000, 1000, 200, 150));
+    }
+
+    QCOMPARE(result, EmptyImage());
+}